@@ -0,0 +1,259 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "benchmark/benchmark_api.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+using atomic_exec = RAJA::omp_parallel_for_exec;
+#else
+using atomic_exec = RAJA::seq_exec;
+#endif
+
+//
+// Atomic adds of 1e6 updates into a table of state.range(1) counters: one
+// counter is the fully contended case, larger tables a histogram.  The
+// atomic policies are compared with the compare-and-swap loop builtin_atomic
+// uses for types without native fetch-and-op builtins.
+//
+template <typename AtomicPolicy, typename T>
+static void benchmark_atomic_add(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const RAJA::Index_type nbins = state.range(1);
+  std::vector<T> table(nbins);
+  T* bins = table.data();
+  while (state.KeepRunning()) {
+    RAJA::forall<atomic_exec>(RAJA::RangeSegment(0, n),
+                              [=](RAJA::Index_type i) {
+                                RAJA::atomicAdd<AtomicPolicy>(
+                                    bins + (i * 7919) % nbins, T(1));
+                              });
+    benchmark::DoNotOptimize(bins[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename T>
+static void benchmark_cas_loop_add(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const RAJA::Index_type nbins = state.range(1);
+  std::vector<T> table(nbins);
+  T* bins = table.data();
+  while (state.KeepRunning()) {
+    RAJA::forall<atomic_exec>(RAJA::RangeSegment(0, n),
+                              [=](RAJA::Index_type i) {
+                                RAJA::detail::builtin_atomic_CAS_oper<
+                                    RAJA::detail::builtin_order_acq_rel>(
+                                    bins + (i * 7919) % nbins,
+                                    [=](T a) { return a + T(1); });
+                              });
+    benchmark::DoNotOptimize(bins[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+//
+// Scatter-add of 1e6 updates at random indices into a View of
+// state.range(1) elements, through an atomic view and through a sharded
+// view including its flush.  Smaller targets mean more conflicts.  Each
+// run of state.range(2) consecutive updates goes to the same element, as
+// when neighbouring loop iterations update shared nodes.
+//
+static std::vector<RAJA::Index_type> random_indices(RAJA::Index_type n,
+                                                    RAJA::Index_type m,
+                                                    RAJA::Index_type run)
+{
+  std::vector<RAJA::Index_type> idx(n);
+  std::uint64_t x = 88172645463325252ull;
+  for (RAJA::Index_type k = 0; k < n; ++k) {
+    if (k % run == 0) {
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+    }
+    idx[k] = static_cast<RAJA::Index_type>(x % m);
+  }
+  return idx;
+}
+
+static void benchmark_atomic_view_scatter(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const RAJA::Index_type m = state.range(1);
+  const std::vector<RAJA::Index_type> indices =
+      random_indices(n, m, state.range(2));
+  const RAJA::Index_type* idx = indices.data();
+  std::vector<double> target(m);
+  RAJA::View<double, RAJA::Layout<1>> view(target.data(), m);
+  auto atomic_view = RAJA::make_atomic_view<RAJA::auto_atomic>(view);
+  while (state.KeepRunning()) {
+    RAJA::forall<atomic_exec>(RAJA::RangeSegment(0, n),
+                              [=](RAJA::Index_type i) {
+                                atomic_view(idx[i]) += 1.0;
+                              });
+    benchmark::DoNotOptimize(target[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void benchmark_sharded_view_scatter(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const RAJA::Index_type m = state.range(1);
+  const std::vector<RAJA::Index_type> indices =
+      random_indices(n, m, state.range(2));
+  const RAJA::Index_type* idx = indices.data();
+  std::vector<double> target(m);
+  RAJA::View<double, RAJA::Layout<1>> view(target.data(), m);
+  auto sharded = RAJA::make_sharded_atomic_view<RAJA::auto_atomic>(view);
+  while (state.KeepRunning()) {
+    RAJA::forall<atomic_exec>(RAJA::RangeSegment(0, n),
+                              [=](RAJA::Index_type i) {
+                                sharded(idx[i]) += 1.0;
+                              });
+    sharded.flush(atomic_exec{});
+    benchmark::DoNotOptimize(target[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+#define SCATTER_SIZES                                           \
+  ->Args({1000000, 64, 1})->Args({1000000, 4096, 1})            \
+      ->Args({1000000, 65536, 1})->Args({1000000, 1 << 20, 1})  \
+      ->Args({1000000, 1 << 24, 1})->Args({1000000, 1 << 20, 8})
+
+BENCHMARK(benchmark_atomic_view_scatter) SCATTER_SIZES;
+BENCHMARK(benchmark_sharded_view_scatter) SCATTER_SIZES;
+
+//
+// Location of the minimum of state.range(0) values by atomicMinLoc on a
+// 16-byte value-location pair, compared against a MinLoc reduction.
+//
+template <typename AtomicPolicy>
+static void benchmark_atomic_minloc(benchmark::State& state)
+{
+  using MinLoc = RAJA::reduce::detail::ValueLoc<double, RAJA::Index_type>;
+  const RAJA::Index_type n = state.range(0);
+  const std::vector<RAJA::Index_type> indices = random_indices(n, n, 1);
+  const RAJA::Index_type* idx = indices.data();
+  alignas(16) MinLoc best;
+  MinLoc* bp = &best;
+  while (state.KeepRunning()) {
+    best = MinLoc(static_cast<double>(n), -1);
+    RAJA::forall<atomic_exec>(RAJA::RangeSegment(0, n),
+                              [=](RAJA::Index_type i) {
+                                RAJA::atomicMinLoc<AtomicPolicy>(
+                                    bp, static_cast<double>(idx[i]), i);
+                              });
+    benchmark::DoNotOptimize(best.loc);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void benchmark_reduce_minloc(benchmark::State& state)
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  using reduce_pol = RAJA::omp_reduce;
+#else
+  using reduce_pol = RAJA::seq_reduce;
+#endif
+  const RAJA::Index_type n = state.range(0);
+  const std::vector<RAJA::Index_type> indices = random_indices(n, n, 1);
+  const RAJA::Index_type* idx = indices.data();
+  while (state.KeepRunning()) {
+    RAJA::ReduceMinLoc<reduce_pol, double, RAJA::Index_type> best(
+        static_cast<double>(n), -1);
+    RAJA::forall<atomic_exec>(RAJA::RangeSegment(0, n),
+                              [=](RAJA::Index_type i) {
+                                best.minloc(static_cast<double>(idx[i]), i);
+                              });
+    benchmark::DoNotOptimize(best.getLoc());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK_TEMPLATE(benchmark_atomic_minloc, RAJA::builtin_atomic)
+    ->Arg(1000000);
+BENCHMARK(benchmark_reduce_minloc)->Arg(1000000);
+
+//
+// Throughput of 1e6 atomic adds by state.range(2) threads into
+// state.range(1) counters, at which contention the exponential backoff of
+// builtin_atomic_backoff pays for its delay.  The adds are on doubles,
+// which take the compare-and-swap loop.
+//
+template <typename AtomicPolicy>
+static void benchmark_atomic_threads(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const RAJA::Index_type nbins = state.range(1);
+  std::vector<double> table(nbins);
+  double* bins = table.data();
+#if defined(RAJA_ENABLE_OPENMP)
+  const int nthreads = omp_get_max_threads();
+  omp_set_num_threads(static_cast<int>(state.range(2)));
+#endif
+  while (state.KeepRunning()) {
+    RAJA::forall<atomic_exec>(RAJA::RangeSegment(0, n),
+                              [=](RAJA::Index_type i) {
+                                RAJA::atomicAdd<AtomicPolicy>(
+                                    bins + (i * 7919) % nbins, 1.0);
+                              });
+    benchmark::DoNotOptimize(bins[0]);
+  }
+#if defined(RAJA_ENABLE_OPENMP)
+  omp_set_num_threads(nthreads);
+#endif
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+#define THREAD_COUNTS(nbins)                                            \
+  ->Args({1000000, nbins, 1})->Args({1000000, nbins, 2})                \
+      ->Args({1000000, nbins, 4})->Args({1000000, nbins, 8})            \
+      ->Args({1000000, nbins, 16})
+
+#define THREAD_SIZES THREAD_COUNTS(1) THREAD_COUNTS(16) THREAD_COUNTS(1024)
+
+BENCHMARK_TEMPLATE(benchmark_atomic_threads, RAJA::builtin_atomic)
+THREAD_SIZES;
+BENCHMARK_TEMPLATE(benchmark_atomic_threads, RAJA::builtin_atomic_backoff)
+THREAD_SIZES;
+
+#define ATOMIC_SIZES \
+  ->Args({1000000, 1})->Args({1000000, 64})->Args({1000000, 65536})
+
+BENCHMARK_TEMPLATE(benchmark_atomic_add, RAJA::builtin_atomic, int)
+ATOMIC_SIZES;
+BENCHMARK_TEMPLATE(benchmark_atomic_add, RAJA::builtin_atomic_relaxed, int)
+ATOMIC_SIZES;
+BENCHMARK_TEMPLATE(benchmark_cas_loop_add, int) ATOMIC_SIZES;
+BENCHMARK_TEMPLATE(benchmark_atomic_add, RAJA::builtin_atomic, long long)
+ATOMIC_SIZES;
+BENCHMARK_TEMPLATE(benchmark_cas_loop_add, long long) ATOMIC_SIZES;
+BENCHMARK_TEMPLATE(benchmark_atomic_add, RAJA::builtin_atomic, double)
+ATOMIC_SIZES;
+BENCHMARK_TEMPLATE(benchmark_atomic_add,
+                   RAJA::builtin_atomic_relaxed,
+                   double)
+ATOMIC_SIZES;
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_atomic_add, RAJA::omp_atomic, int) ATOMIC_SIZES;
+BENCHMARK_TEMPLATE(benchmark_atomic_add, RAJA::omp_atomic_relaxed, int)
+ATOMIC_SIZES;
+BENCHMARK_TEMPLATE(benchmark_atomic_add, RAJA::omp_atomic, double)
+ATOMIC_SIZES;
+BENCHMARK_TEMPLATE(benchmark_atomic_add, RAJA::omp_atomic_relaxed, double)
+ATOMIC_SIZES;
+#endif
+
+BENCHMARK_MAIN();
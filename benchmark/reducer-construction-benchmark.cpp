@@ -0,0 +1,76 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+//
+// Cost of constructing, updating once, reading and destroying a reducer.
+// This is the per-timestep overhead paid by codes that create reducers
+// inside their time loops.
+//
+template <typename ReducePolicy>
+static void benchmark_reducer_construction(benchmark::State& state)
+{
+  double total = 0.0;
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<ReducePolicy, double> sum(0.0);
+    sum += 1.0;
+    total += sum.get();
+  }
+  benchmark::DoNotOptimize(total);
+}
+
+template <typename ReducePolicy>
+static void benchmark_minloc_construction(benchmark::State& state)
+{
+  double total = 0.0;
+  while (state.KeepRunning()) {
+    RAJA::ReduceMinLoc<ReducePolicy, double> minloc(1.0e10, -1);
+    minloc.minloc(1.0, 1);
+    total += minloc.get();
+  }
+  benchmark::DoNotOptimize(total);
+}
+
+//
+// Construction plus one small parallel loop, which also pays for the
+// per-thread copies of the reducer.
+//
+template <typename ExecPolicy, typename ReducePolicy>
+static void benchmark_reducer_small_loop(benchmark::State& state)
+{
+  double total = 0.0;
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<ReducePolicy, double> sum(0.0);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, 64),
+                             [=](int i) { sum += i; });
+    total += sum.get();
+  }
+  benchmark::DoNotOptimize(total);
+}
+
+BENCHMARK_TEMPLATE(benchmark_reducer_construction, RAJA::seq_reduce);
+BENCHMARK_TEMPLATE(benchmark_minloc_construction, RAJA::seq_reduce);
+BENCHMARK_TEMPLATE(benchmark_reducer_small_loop, RAJA::seq_exec, RAJA::seq_reduce);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_reducer_construction, RAJA::omp_reduce);
+BENCHMARK_TEMPLATE(benchmark_reducer_construction, RAJA::omp_reduce_ordered);
+BENCHMARK_TEMPLATE(benchmark_minloc_construction, RAJA::omp_reduce);
+BENCHMARK_TEMPLATE(benchmark_minloc_construction, RAJA::omp_reduce_ordered);
+BENCHMARK_TEMPLATE(benchmark_reducer_small_loop, RAJA::omp_parallel_for_exec, RAJA::omp_reduce);
+BENCHMARK_TEMPLATE(benchmark_reducer_small_loop, RAJA::omp_parallel_for_exec, RAJA::omp_reduce_ordered);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_reducer_construction, RAJA::tbb_reduce);
+BENCHMARK_TEMPLATE(benchmark_minloc_construction, RAJA::tbb_reduce);
+BENCHMARK_TEMPLATE(benchmark_reducer_small_loop, RAJA::tbb_for_exec, RAJA::tbb_reduce);
+#endif
+
+BENCHMARK_MAIN();
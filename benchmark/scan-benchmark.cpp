@@ -0,0 +1,59 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "benchmark/benchmark_api.h"
+
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+//
+// Out-of-place inclusive scans of 1e6 to 1e9 ints.  The largest size needs
+// 8 GB for the input and output; use --benchmark_filter to skip it.
+//
+template <typename ExecPolicy>
+static void benchmark_inclusive_scan(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  std::vector<int> in(n, 1);
+  std::vector<int> out(n);
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan<ExecPolicy>(in.data(), in.data() + n, out.data());
+    benchmark::DoNotOptimize(out[n - 1]);
+  }
+  state.SetBytesProcessed(state.iterations() * n * 2 * sizeof(int));
+}
+
+template <typename ExecPolicy>
+static void benchmark_exclusive_scan_inplace(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  std::vector<int> data(n, 1);
+  while (state.KeepRunning()) {
+    RAJA::exclusive_scan_inplace<ExecPolicy>(data.data(), data.data() + n);
+    benchmark::DoNotOptimize(data[n - 1]);
+  }
+  state.SetBytesProcessed(state.iterations() * n * 2 * sizeof(int));
+}
+
+#define SCAN_SIZES ->Arg(1000000)->Arg(10000000)->Arg(100000000)->Arg(1000000000)
+
+BENCHMARK_TEMPLATE(benchmark_inclusive_scan, RAJA::seq_exec) SCAN_SIZES;
+BENCHMARK_TEMPLATE(benchmark_exclusive_scan_inplace, RAJA::seq_exec) SCAN_SIZES;
+
+BENCHMARK_TEMPLATE(benchmark_inclusive_scan, RAJA::simd_exec) SCAN_SIZES;
+BENCHMARK_TEMPLATE(benchmark_exclusive_scan_inplace, RAJA::simd_exec)
+SCAN_SIZES;
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_inclusive_scan, RAJA::omp_parallel_for_exec)
+SCAN_SIZES;
+BENCHMARK_TEMPLATE(benchmark_exclusive_scan_inplace,
+                   RAJA::omp_parallel_for_exec)
+SCAN_SIZES;
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "benchmark/benchmark_api.h"
+
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+//
+// A weighted histogram of 1e6 random values into state.range(0) bins, as a
+// loop adding to the bins under seq_exec and as scatter_add.  Fewer bins
+// mean more iterations of each vector adding to the same bin.
+//
+const RAJA::Index_type num_values = 1000000;
+
+static std::vector<double> make_values()
+{
+  std::mt19937_64 gen(12345);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  std::vector<double> values(num_values);
+  for (auto& v : values) {
+    v = dist(gen);
+  }
+  return values;
+}
+
+struct Tally {
+  const double* x;
+  double scale;
+  RAJA::Index_type nbins;
+
+  RAJA_INLINE void operator()(RAJA::Index_type i,
+                              RAJA::Index_type& bin,
+                              double& weight) const
+  {
+    const RAJA::Index_type b = static_cast<RAJA::Index_type>(x[i] * scale);
+    bin = b < nbins ? b : nbins - 1;
+    weight = x[i] / (1.0 + x[i] * x[i]);
+  }
+};
+
+static void benchmark_tally_loop(benchmark::State& state)
+{
+  const RAJA::Index_type nbins = state.range(0);
+  const std::vector<double> values = make_values();
+  std::vector<double> hist(nbins);
+  double* bins = hist.data();
+  const Tally tally{values.data(), static_cast<double>(nbins), nbins};
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, num_values),
+                                 [=](RAJA::Index_type i) {
+                                   RAJA::Index_type bin;
+                                   double weight;
+                                   tally(i, bin, weight);
+                                   bins[bin] += weight;
+                                 });
+    benchmark::DoNotOptimize(bins[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * num_values);
+}
+
+template <typename ExecPolicy>
+static void benchmark_scatter_add(benchmark::State& state)
+{
+  const RAJA::Index_type nbins = state.range(0);
+  const std::vector<double> values = make_values();
+  std::vector<double> hist(nbins);
+  const Tally tally{values.data(), static_cast<double>(nbins), nbins};
+  while (state.KeepRunning()) {
+    RAJA::scatter_add<ExecPolicy>(
+        RAJA::RangeSegment(0, num_values), hist.data(), tally);
+    benchmark::DoNotOptimize(hist[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * num_values);
+}
+
+#define BIN_COUNTS \
+  ->Arg(1)->Arg(16)->Arg(256)->Arg(4096)->Arg(1 << 20)
+
+BENCHMARK(benchmark_tally_loop) BIN_COUNTS;
+BENCHMARK_TEMPLATE(benchmark_scatter_add, RAJA::seq_exec) BIN_COUNTS;
+BENCHMARK_TEMPLATE(benchmark_scatter_add, RAJA::simd_exec) BIN_COUNTS;
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_scatter_add, RAJA::omp_parallel_for_exec)
+BIN_COUNTS;
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,112 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "benchmark/benchmark_api.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+//
+// 1e6 lookups of random values into sorted tables of 1e3 to 1e7 doubles,
+// as in a tabulated equation of state, compared against a loop of
+// std::lower_bound.  The sorted variants look up the same values sorted.
+//
+const RAJA::Index_type num_queries = 1000000;
+
+static std::vector<double> make_table(RAJA::Index_type n)
+{
+  std::vector<double> table(n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    table[i] = static_cast<double>(i) / n;
+  }
+  return table;
+}
+
+static std::vector<double> make_queries(bool sorted)
+{
+  std::mt19937_64 gen(12345);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  std::vector<double> queries(num_queries);
+  for (auto& q : queries) {
+    q = dist(gen);
+  }
+  if (sorted) {
+    std::sort(queries.begin(), queries.end());
+  }
+  return queries;
+}
+
+static void benchmark_std_lower_bound(benchmark::State& state)
+{
+  const std::vector<double> table = make_table(state.range(0));
+  const std::vector<double> queries = make_queries(false);
+  std::vector<RAJA::Index_type> out(num_queries);
+  while (state.KeepRunning()) {
+    for (RAJA::Index_type q = 0; q < num_queries; ++q) {
+      out[q] = std::lower_bound(table.begin(), table.end(), queries[q])
+               - table.begin();
+    }
+    benchmark::DoNotOptimize(out[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * num_queries);
+}
+
+template <typename ExecPolicy>
+static void benchmark_lower_bound_batch(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const std::vector<double> table = make_table(n);
+  const std::vector<double> queries = make_queries(false);
+  std::vector<RAJA::Index_type> out(num_queries);
+  while (state.KeepRunning()) {
+    RAJA::lower_bound_batch<ExecPolicy>(
+        table.data(), n, queries.data(), num_queries, out.data());
+    benchmark::DoNotOptimize(out[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * num_queries);
+}
+
+template <typename ExecPolicy>
+static void benchmark_lower_bound_batch_sorted(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const std::vector<double> table = make_table(n);
+  const std::vector<double> queries = make_queries(true);
+  std::vector<RAJA::Index_type> out(num_queries);
+  while (state.KeepRunning()) {
+    RAJA::lower_bound_batch_sorted<ExecPolicy>(
+        table.data(), n, queries.data(), num_queries, out.data());
+    benchmark::DoNotOptimize(out[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * num_queries);
+}
+
+#define TABLE_SIZES ->Arg(1000)->Arg(100000)->Arg(10000000)
+
+BENCHMARK(benchmark_std_lower_bound) TABLE_SIZES;
+
+BENCHMARK_TEMPLATE(benchmark_lower_bound_batch, RAJA::seq_exec) TABLE_SIZES;
+BENCHMARK_TEMPLATE(benchmark_lower_bound_batch, RAJA::simd_exec) TABLE_SIZES;
+BENCHMARK_TEMPLATE(benchmark_lower_bound_batch_sorted, RAJA::seq_exec)
+TABLE_SIZES;
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_lower_bound_batch, RAJA::omp_parallel_for_exec)
+TABLE_SIZES;
+BENCHMARK_TEMPLATE(benchmark_lower_bound_batch_sorted,
+                   RAJA::omp_parallel_for_exec)
+TABLE_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_lower_bound_batch, RAJA::tbb_for_exec)
+TABLE_SIZES;
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "benchmark/benchmark_api.h"
+
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+//
+// Reductions in a simd_exec loop: a captured reducer object serializes
+// the loop on its accumulator, while forall_param gives each SIMD lane its
+// own accumulator.
+//
+static std::vector<double> make_data(RAJA::Index_type n)
+{
+  std::vector<double> data(n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    data[i] = double((i * 7919) % 1009) - 500.0;
+  }
+  return data;
+}
+
+static void benchmark_simd_sum_reducer(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  std::vector<double> data = make_data(n);
+  const double* a = data.data();
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<RAJA::seq_reduce, double> sum(0.0);
+    RAJA::forall<RAJA::simd_exec>(RAJA::RangeSegment(0, n),
+                                  [=](RAJA::Index_type i) { sum += a[i]; });
+    benchmark::DoNotOptimize(sum.get());
+  }
+}
+
+static void benchmark_simd_sum_param(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  std::vector<double> data = make_data(n);
+  const double* a = data.data();
+  while (state.KeepRunning()) {
+    double sum = 0.0;
+    RAJA::forall_param<RAJA::simd_exec>(
+        RAJA::RangeSegment(0, n),
+        RAJA::make_tuple(RAJA::reduce_sum(&sum)),
+        [=](RAJA::Index_type i, double& s) { s += a[i]; });
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+static void benchmark_simd_minloc_reducer(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  std::vector<double> data = make_data(n);
+  const double* a = data.data();
+  while (state.KeepRunning()) {
+    RAJA::ReduceMinLoc<RAJA::seq_reduce, double> vmin(1.0e10, -1);
+    RAJA::forall<RAJA::simd_exec>(RAJA::RangeSegment(0, n),
+                                  [=](RAJA::Index_type i) {
+                                    vmin.minloc(a[i], i);
+                                  });
+    benchmark::DoNotOptimize(vmin.getLoc());
+  }
+}
+
+static void benchmark_simd_minloc_param(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  std::vector<double> data = make_data(n);
+  const double* a = data.data();
+  while (state.KeepRunning()) {
+    double vmin = 1.0e10;
+    RAJA::Index_type loc = -1;
+    RAJA::forall_param<RAJA::simd_exec>(
+        RAJA::RangeSegment(0, n),
+        RAJA::make_tuple(RAJA::reduce_minloc(&vmin, &loc)),
+        [=](RAJA::Index_type i, RAJA::MinLocValue<double>& m) {
+          m.minloc(a[i], i);
+        });
+    benchmark::DoNotOptimize(loc);
+  }
+}
+
+BENCHMARK(benchmark_simd_sum_reducer)->Arg(1 << 16);
+BENCHMARK(benchmark_simd_sum_param)->Arg(1 << 16);
+BENCHMARK(benchmark_simd_minloc_reducer)->Arg(1 << 16);
+BENCHMARK(benchmark_simd_minloc_param)->Arg(1 << 16);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,245 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "benchmark/benchmark_api.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#if __cplusplus >= 201703L
+#include <execution>
+#endif
+
+#include "RAJA/RAJA.hpp"
+
+//
+// Sorts of 1e5 to 1e8 random doubles, compared against std::sort and, when
+// built as C++17 with a standard library that provides it, the parallel
+// std::sort.  The input is restored outside the timed region.
+//
+static std::vector<double> random_data(RAJA::Index_type n)
+{
+  std::mt19937_64 gen(12345);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  std::vector<double> data(n);
+  for (auto& v : data) {
+    v = dist(gen);
+  }
+  return data;
+}
+
+template <typename ExecPolicy>
+static void benchmark_raja_sort(benchmark::State& state)
+{
+  const std::vector<double> in = random_data(state.range(0));
+  std::vector<double> data(in.size());
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    data = in;
+    state.ResumeTiming();
+    RAJA::sort<ExecPolicy>(data.begin(), data.end());
+    benchmark::DoNotOptimize(data[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename ExecPolicy>
+static void benchmark_raja_stable_sort(benchmark::State& state)
+{
+  const std::vector<double> in = random_data(state.range(0));
+  std::vector<double> data(in.size());
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    data = in;
+    state.ResumeTiming();
+    RAJA::stable_sort<ExecPolicy>(data.begin(), data.end());
+    benchmark::DoNotOptimize(data[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void benchmark_std_sort(benchmark::State& state)
+{
+  const std::vector<double> in = random_data(state.range(0));
+  std::vector<double> data(in.size());
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    data = in;
+    state.ResumeTiming();
+    std::sort(data.begin(), data.end());
+    benchmark::DoNotOptimize(data[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#if defined(__cpp_lib_parallel_algorithm)
+static void benchmark_std_par_sort(benchmark::State& state)
+{
+  const std::vector<double> in = random_data(state.range(0));
+  std::vector<double> data(in.size());
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    data = in;
+    state.ResumeTiming();
+    std::sort(std::execution::par, data.begin(), data.end());
+    benchmark::DoNotOptimize(data[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+#endif
+
+//
+// Sorts of 64-bit cell keys with 40 significant bits and int particle ids,
+// by radix sort and by std::sort of key-id pairs.
+//
+static std::vector<std::uint64_t> random_cells(RAJA::Index_type n)
+{
+  std::mt19937_64 gen(12345);
+  std::vector<std::uint64_t> cells(n);
+  for (auto& c : cells) {
+    c = gen() >> 24;
+  }
+  return cells;
+}
+
+template <typename ExecPolicy>
+static void benchmark_raja_sort_pairs(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const std::vector<std::uint64_t> cells = random_cells(n);
+  std::vector<std::uint64_t> keys(n);
+  std::vector<int> ids(n);
+  RAJA::RadixSortScratch<std::uint64_t, int> scratch;
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    keys = cells;
+    for (RAJA::Index_type i = 0; i < n; ++i) {
+      ids[i] = static_cast<int>(i);
+    }
+    state.ResumeTiming();
+    RAJA::sort_pairs<ExecPolicy>(keys.data(), ids.data(), n, scratch, 0, 40);
+    benchmark::DoNotOptimize(ids[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void benchmark_std_sort_pairs(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const std::vector<std::uint64_t> cells = random_cells(n);
+  std::vector<std::pair<std::uint64_t, int>> pairs(n);
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    for (RAJA::Index_type i = 0; i < n; ++i) {
+      pairs[i] = std::make_pair(cells[i], static_cast<int>(i));
+    }
+    state.ResumeTiming();
+    std::sort(pairs.begin(), pairs.end());
+    benchmark::DoNotOptimize(pairs[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+//
+// Medians of random doubles by nth_element, which rearranges the input, and
+// by percentile, which leaves it unchanged, compared against std::nth_element.
+//
+static void benchmark_std_nth_element(benchmark::State& state)
+{
+  const std::vector<double> in = random_data(state.range(0));
+  std::vector<double> data(in.size());
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    data = in;
+    state.ResumeTiming();
+    std::nth_element(data.begin(), data.begin() + data.size() / 2, data.end());
+    benchmark::DoNotOptimize(data[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename ExecPolicy>
+static void benchmark_raja_nth_element(benchmark::State& state)
+{
+  const std::vector<double> in = random_data(state.range(0));
+  std::vector<double> data(in.size());
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    data = in;
+    state.ResumeTiming();
+    RAJA::nth_element<ExecPolicy>(
+        data.begin(), data.begin() + data.size() / 2, data.end());
+    benchmark::DoNotOptimize(data[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename ExecPolicy>
+static void benchmark_raja_percentile(benchmark::State& state)
+{
+  const std::vector<double> data = random_data(state.range(0));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(RAJA::percentile<ExecPolicy>(data, 0.5));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename ExecPolicy>
+static void benchmark_raja_percentile_approx(benchmark::State& state)
+{
+  const std::vector<double> data = random_data(state.range(0));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        RAJA::percentile_approx<ExecPolicy>(data, 0.5, 0.0, 1.0, 1e-4));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define SORT_SIZES ->Arg(100000)->Arg(1000000)->Arg(10000000)->Arg(100000000)
+
+BENCHMARK(benchmark_std_sort) SORT_SIZES;
+BENCHMARK(benchmark_std_sort_pairs) SORT_SIZES;
+BENCHMARK(benchmark_std_nth_element) SORT_SIZES;
+#if defined(__cpp_lib_parallel_algorithm)
+BENCHMARK(benchmark_std_par_sort) SORT_SIZES;
+#endif
+
+BENCHMARK_TEMPLATE(benchmark_raja_sort, RAJA::seq_exec) SORT_SIZES;
+BENCHMARK_TEMPLATE(benchmark_raja_stable_sort, RAJA::seq_exec) SORT_SIZES;
+BENCHMARK_TEMPLATE(benchmark_raja_sort_pairs, RAJA::seq_exec) SORT_SIZES;
+BENCHMARK_TEMPLATE(benchmark_raja_percentile_approx, RAJA::seq_exec)
+SORT_SIZES;
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_raja_sort, RAJA::omp_parallel_for_exec)
+SORT_SIZES;
+BENCHMARK_TEMPLATE(benchmark_raja_stable_sort, RAJA::omp_parallel_for_exec)
+SORT_SIZES;
+BENCHMARK_TEMPLATE(benchmark_raja_sort_pairs, RAJA::omp_parallel_for_exec)
+SORT_SIZES;
+BENCHMARK_TEMPLATE(benchmark_raja_nth_element, RAJA::omp_parallel_for_exec)
+SORT_SIZES;
+BENCHMARK_TEMPLATE(benchmark_raja_percentile, RAJA::omp_parallel_for_exec)
+SORT_SIZES;
+BENCHMARK_TEMPLATE(benchmark_raja_percentile_approx,
+                   RAJA::omp_parallel_for_exec)
+SORT_SIZES;
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_raja_sort, RAJA::tbb_for_exec) SORT_SIZES;
+BENCHMARK_TEMPLATE(benchmark_raja_stable_sort, RAJA::tbb_for_exec)
+SORT_SIZES;
+BENCHMARK_TEMPLATE(benchmark_raja_sort_pairs, RAJA::tbb_for_exec) SORT_SIZES;
+BENCHMARK_TEMPLATE(benchmark_raja_nth_element, RAJA::tbb_for_exec)
+SORT_SIZES;
+BENCHMARK_TEMPLATE(benchmark_raja_percentile, RAJA::tbb_for_exec) SORT_SIZES;
+#endif
+
+BENCHMARK_MAIN();
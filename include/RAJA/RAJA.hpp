@@ -93,6 +93,7 @@
 // in the files included below.
 //
 #include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/forall_param.hpp"
 #include "RAJA/pattern/region.hpp"
 
 #include "RAJA/policy/MultiPolicy.hpp"
@@ -128,6 +129,11 @@
 //
 #include "RAJA/pattern/reduce.hpp"
 
+//
+// Atomic views that buffer updates per thread
+//
+#include "RAJA/util/ShardedAtomicView.hpp"
+
 
 //
 // Synchronization
@@ -151,4 +157,18 @@
 
 #include "RAJA/pattern/scan.hpp"
 
+#include "RAJA/pattern/sort.hpp"
+
+#include "RAJA/pattern/reduce_segmented.hpp"
+
+#include "RAJA/pattern/compact.hpp"
+
+#include "RAJA/pattern/radix_sort.hpp"
+
+#include "RAJA/pattern/search.hpp"
+
+#include "RAJA/pattern/select.hpp"
+
+#include "RAJA/pattern/scatter.hpp"
+
 #endif  // closing endif for header file include guard
@@ -315,6 +315,128 @@ private:
   DifferenceType stride;
 };
 
+/*!
+ * Random access iterator over the results of a unary function applied to
+ * the elements of another iterator; dereferencing calls the function, so
+ * the results are never stored.
+ */
+template <typename Iter, typename UnaryOp>
+class transform_iterator
+{
+public:
+  using value_type = typename std::decay<decltype(
+      std::declval<UnaryOp const&>()(*std::declval<Iter>()))>::type;
+  using difference_type =
+      typename std::iterator_traits<Iter>::difference_type;
+  using pointer = value_type*;
+  using reference = value_type;
+  using iterator_category = std::random_access_iterator_tag;
+
+  RAJA_HOST_DEVICE constexpr transform_iterator(Iter it, UnaryOp op)
+      : it(it), op(op)
+  {
+  }
+
+  RAJA_HOST_DEVICE inline bool operator==(const transform_iterator& rhs) const
+  {
+    return it == rhs.it;
+  }
+  RAJA_HOST_DEVICE inline bool operator!=(const transform_iterator& rhs) const
+  {
+    return it != rhs.it;
+  }
+  RAJA_HOST_DEVICE inline bool operator>(const transform_iterator& rhs) const
+  {
+    return it > rhs.it;
+  }
+  RAJA_HOST_DEVICE inline bool operator<(const transform_iterator& rhs) const
+  {
+    return it < rhs.it;
+  }
+  RAJA_HOST_DEVICE inline bool operator>=(const transform_iterator& rhs) const
+  {
+    return it >= rhs.it;
+  }
+  RAJA_HOST_DEVICE inline bool operator<=(const transform_iterator& rhs) const
+  {
+    return it <= rhs.it;
+  }
+
+  RAJA_HOST_DEVICE inline transform_iterator& operator++()
+  {
+    ++it;
+    return *this;
+  }
+  RAJA_HOST_DEVICE inline transform_iterator& operator--()
+  {
+    --it;
+    return *this;
+  }
+  RAJA_HOST_DEVICE inline transform_iterator operator++(int)
+  {
+    transform_iterator tmp(*this);
+    ++it;
+    return tmp;
+  }
+  RAJA_HOST_DEVICE inline transform_iterator operator--(int)
+  {
+    transform_iterator tmp(*this);
+    --it;
+    return tmp;
+  }
+
+  RAJA_HOST_DEVICE inline transform_iterator& operator+=(
+      const difference_type& rhs)
+  {
+    it += rhs;
+    return *this;
+  }
+  RAJA_HOST_DEVICE inline transform_iterator& operator-=(
+      const difference_type& rhs)
+  {
+    it -= rhs;
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE inline difference_type operator-(
+      const transform_iterator& rhs) const
+  {
+    return it - rhs.it;
+  }
+  RAJA_HOST_DEVICE inline transform_iterator operator+(
+      const difference_type& rhs) const
+  {
+    return transform_iterator(it + rhs, op);
+  }
+  RAJA_HOST_DEVICE inline transform_iterator operator-(
+      const difference_type& rhs) const
+  {
+    return transform_iterator(it - rhs, op);
+  }
+  RAJA_HOST_DEVICE friend inline transform_iterator operator+(
+      difference_type lhs,
+      const transform_iterator& rhs)
+  {
+    return transform_iterator(rhs.it + lhs, rhs.op);
+  }
+
+  RAJA_HOST_DEVICE inline value_type operator*() const { return op(*it); }
+  RAJA_HOST_DEVICE inline value_type operator[](difference_type rhs) const
+  {
+    return op(*(it + rhs));
+  }
+
+private:
+  Iter it;
+  UnaryOp op;
+};
+
+template <typename Iter, typename UnaryOp>
+RAJA_HOST_DEVICE inline transform_iterator<Iter, UnaryOp>
+make_transform_iterator(Iter it, UnaryOp op)
+{
+  return transform_iterator<Iter, UnaryOp>(it, op);
+}
 
 }  // namespace Iterators
 
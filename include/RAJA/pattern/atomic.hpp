@@ -23,6 +23,7 @@
 #include "RAJA/policy/atomic_auto.hpp"
 #include "RAJA/policy/atomic_builtin.hpp"
 
+#include "RAJA/util/AtomicStats.hpp"
 #include "RAJA/util/macros.hpp"
 
 namespace RAJA
@@ -58,6 +59,15 @@ namespace RAJA
  *
  *   builtin_atomic    -- Use the (nonstandard) __sync_fetch_and_XXX functions
  *
+ *   omp_atomic_relaxed, builtin_atomic_relaxed
+ *                     -- As omp_atomic and builtin_atomic, but with relaxed
+ *                        memory ordering, for counters and histograms
+ *
+ *   builtin_atomic_backoff
+ *                     -- As builtin_atomic, but backs off exponentially
+ *                        between compare-and-swap retries, for heavily
+ *                        contended targets
+ *
  *   seq_atomic        -- Non-atomic, does an unprotected (raw) operation
  *
  *
@@ -67,10 +77,14 @@ namespace RAJA
  *      -Native atomic support for "unsigned", "long", "unsigned long long" and
  *      "long long"
  *
- *      -General support, via CAS algorithm, for any 32-bit or 64-bit datatype
+ *      -General support, via CAS algorithm, for any 32-bit or 64-bit datatype,
+ *      and with builtin atomics on the host for any 128-bit datatype
  *
  *   32-bit and 64-bit floating point types:  float and double
  *
+ *   value-location pairs, such as ValueLoc<double, Index_type>, for
+ *   atomicMinLoc and atomicMaxLoc on the host
+ *
  *
  * The implementation code lives in:
  * RAJA/policy/atomic_auto.hpp     -- for auto_atomic
@@ -88,8 +102,10 @@ namespace RAJA
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicAdd(T volatile *acc, T value)
+RAJA_INLINE RAJA_HOST_DEVICE T atomicAdd(T volatile *acc,
+                                         T value RAJA_ATOMIC_SITE_PARAM)
 {
+  RAJA_ATOMIC_STATS_SCOPE;
   return RAJA::atomicAdd(Policy{}, acc, value);
 }
 
@@ -102,8 +118,10 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicAdd(T volatile *acc, T value)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicSub(T volatile *acc, T value)
+RAJA_INLINE RAJA_HOST_DEVICE T atomicSub(T volatile *acc,
+                                         T value RAJA_ATOMIC_SITE_PARAM)
 {
+  RAJA_ATOMIC_STATS_SCOPE;
   return RAJA::atomicSub(Policy{}, acc, value);
 }
 
@@ -116,8 +134,10 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicSub(T volatile *acc, T value)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicMin(T volatile *acc, T value)
+RAJA_INLINE RAJA_HOST_DEVICE T atomicMin(T volatile *acc,
+                                         T value RAJA_ATOMIC_SITE_PARAM)
 {
+  RAJA_ATOMIC_STATS_SCOPE;
   return RAJA::atomicMin(Policy{}, acc, value);
 }
 
@@ -130,8 +150,10 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicMin(T volatile *acc, T value)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicMax(T volatile *acc, T value)
+RAJA_INLINE RAJA_HOST_DEVICE T atomicMax(T volatile *acc,
+                                         T value RAJA_ATOMIC_SITE_PARAM)
 {
+  RAJA_ATOMIC_STATS_SCOPE;
   return RAJA::atomicMax(Policy{}, acc, value);
 }
 
@@ -143,8 +165,9 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicMax(T volatile *acc, T value)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicInc(T volatile *acc)
+RAJA_INLINE RAJA_HOST_DEVICE T atomicInc(T volatile *acc RAJA_ATOMIC_SITE_PARAM)
 {
+  RAJA_ATOMIC_STATS_SCOPE;
   return RAJA::atomicInc(Policy{}, acc);
 }
 
@@ -159,8 +182,10 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicInc(T volatile *acc)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicInc(T volatile *acc, T compare)
+RAJA_INLINE RAJA_HOST_DEVICE T atomicInc(T volatile *acc,
+                                         T compare RAJA_ATOMIC_SITE_PARAM)
 {
+  RAJA_ATOMIC_STATS_SCOPE;
   return RAJA::atomicInc(Policy{}, acc, compare);
 }
 
@@ -172,8 +197,9 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicInc(T volatile *acc, T compare)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicDec(T volatile *acc)
+RAJA_INLINE RAJA_HOST_DEVICE T atomicDec(T volatile *acc RAJA_ATOMIC_SITE_PARAM)
 {
+  RAJA_ATOMIC_STATS_SCOPE;
   return RAJA::atomicDec(Policy{}, acc);
 }
 
@@ -188,8 +214,10 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicDec(T volatile *acc)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicDec(T volatile *acc, T compare)
+RAJA_INLINE RAJA_HOST_DEVICE T atomicDec(T volatile *acc,
+                                         T compare RAJA_ATOMIC_SITE_PARAM)
 {
+  RAJA_ATOMIC_STATS_SCOPE;
   return RAJA::atomicDec(Policy{}, acc, compare);
 }
 
@@ -203,8 +231,10 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicDec(T volatile *acc, T compare)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicAnd(T volatile *acc, T value)
+RAJA_INLINE RAJA_HOST_DEVICE T atomicAnd(T volatile *acc,
+                                         T value RAJA_ATOMIC_SITE_PARAM)
 {
+  RAJA_ATOMIC_STATS_SCOPE;
   static_assert(std::is_integral<T>::value,
                 "atomicAnd can only be used on integral types");
   return RAJA::atomicAnd(Policy{}, acc, value);
@@ -220,8 +250,10 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicAnd(T volatile *acc, T value)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicOr(T volatile *acc, T value)
+RAJA_INLINE RAJA_HOST_DEVICE T atomicOr(T volatile *acc,
+                                        T value RAJA_ATOMIC_SITE_PARAM)
 {
+  RAJA_ATOMIC_STATS_SCOPE;
   static_assert(std::is_integral<T>::value,
                 "atomicOr can only be used on integral types");
   return RAJA::atomicOr(Policy{}, acc, value);
@@ -237,8 +269,10 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicOr(T volatile *acc, T value)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicXor(T volatile *acc, T value)
+RAJA_INLINE RAJA_HOST_DEVICE T atomicXor(T volatile *acc,
+                                         T value RAJA_ATOMIC_SITE_PARAM)
 {
+  RAJA_ATOMIC_STATS_SCOPE;
   static_assert(std::is_integral<T>::value,
                 "atomicXor can only be used on integral types");
   return RAJA::atomicXor(Policy{}, acc, value);
@@ -253,8 +287,10 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicXor(T volatile *acc, T value)
  */
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicExchange(T volatile *acc, T value)
+RAJA_INLINE RAJA_HOST_DEVICE T atomicExchange(T volatile *acc,
+                                              T value RAJA_ATOMIC_SITE_PARAM)
 {
+  RAJA_ATOMIC_STATS_SCOPE;
   return RAJA::atomicExchange(Policy{}, acc, value);
 }
 
@@ -269,11 +305,54 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicExchange(T volatile *acc, T value)
 
 RAJA_SUPPRESS_HD_WARN
 template <typename Policy, typename T>
-RAJA_INLINE RAJA_HOST_DEVICE T atomicCAS(T volatile *acc, T compare, T value)
+RAJA_INLINE RAJA_HOST_DEVICE T atomicCAS(T volatile *acc,
+                                         T compare,
+                                         T value RAJA_ATOMIC_SITE_PARAM)
 {
+  RAJA_ATOMIC_STATS_SCOPE;
   return RAJA::atomicCAS(Policy{}, acc, compare, value);
 }
 
+
+/*!
+ * @brief Atomic minimum with location on a value-location pair, such as
+ * ValueLoc<double, Index_type>: replaces *acc by (value, loc) if value is
+ * less than acc->val, or equal to it and loc is less than acc->loc.
+ * Host atomic policies only; 16-byte pairs are lock-free where the platform
+ * has a 16-byte CAS and *acc is 16-byte aligned.
+ * @param acc Pointer to location of result pair
+ * @param value Value to compare to acc->val
+ * @param loc Location of value
+ * @return Returns pair at acc immediately before this operation completed
+ */
+template <typename Policy, typename T, typename ValueType, typename IndexType>
+RAJA_INLINE T atomicMinLoc(T volatile *acc,
+                           ValueType value,
+                           IndexType loc RAJA_ATOMIC_SITE_PARAM)
+{
+  RAJA_ATOMIC_STATS_SCOPE;
+  return RAJA::atomicMinLoc(Policy{}, acc, T(value, loc));
+}
+
+
+/*!
+ * @brief Atomic maximum with location on a value-location pair: replaces
+ * *acc by (value, loc) if value is greater than acc->val, or equal to it and
+ * loc is less than acc->loc.  Host atomic policies only.
+ * @param acc Pointer to location of result pair
+ * @param value Value to compare to acc->val
+ * @param loc Location of value
+ * @return Returns pair at acc immediately before this operation completed
+ */
+template <typename Policy, typename T, typename ValueType, typename IndexType>
+RAJA_INLINE T atomicMaxLoc(T volatile *acc,
+                           ValueType value,
+                           IndexType loc RAJA_ATOMIC_SITE_PARAM)
+{
+  RAJA_ATOMIC_STATS_SCOPE;
+  return RAJA::atomicMaxLoc(Policy{}, acc, T(value, loc));
+}
+
 /*!
  * \brief Atomic wrapper object
  *
@@ -291,13 +370,13 @@ public:
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
-  constexpr explicit AtomicRef(value_type *value_ptr)
-      : m_value_ptr(value_ptr){};
+  constexpr explicit AtomicRef(value_type *value_ptr RAJA_ATOMIC_SITE_PARAM)
+      : m_value_ptr(value_ptr) RAJA_ATOMIC_SITE_INIT(m_site, atomic_site){};
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   constexpr AtomicRef(AtomicRef const&c)
-      : m_value_ptr(c.m_value_ptr){};
+      : m_value_ptr(c.m_value_ptr) RAJA_ATOMIC_SITE_INIT(m_site, c.m_site){};
 
   AtomicRef& operator=(AtomicRef const&) = delete;
 
@@ -338,14 +417,17 @@ public:
   RAJA_HOST_DEVICE
   value_type exchange(value_type rhs) const
   {
-    return RAJA::atomicExchange<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicExchange<Policy>(m_value_ptr,
+                                        rhs RAJA_ATOMIC_SITE_ARG(m_site));
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type CAS(value_type compare, value_type rhs) const
   {
-    return RAJA::atomicCAS<Policy>(m_value_ptr, compare, rhs);
+    return RAJA::atomicCAS<Policy>(m_value_ptr,
+                                   compare,
+                                   rhs RAJA_ATOMIC_SITE_ARG(m_site));
   }
 
   RAJA_INLINE
@@ -353,7 +435,9 @@ public:
   bool compare_exchange_strong(value_type& expect, value_type rhs) const
   {
     value_type compare = expect;
-    value_type old = RAJA::atomicCAS<Policy>(m_value_ptr, compare, rhs);
+    value_type old = RAJA::atomicCAS<Policy>(m_value_ptr,
+                                             compare,
+                                             rhs RAJA_ATOMIC_SITE_ARG(m_site));
     if (compare == old) {
       return true;
     } else {
@@ -373,70 +457,80 @@ public:
   RAJA_HOST_DEVICE
   value_type operator++() const
   {
-    return RAJA::atomicInc<Policy>(m_value_ptr) + 1;
+    return RAJA::atomicInc<Policy>(m_value_ptr RAJA_ATOMIC_SITE_ARG(m_site))
+           + 1;
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator++(int) const
   {
-    return RAJA::atomicInc<Policy>(m_value_ptr);
+    return RAJA::atomicInc<Policy>(m_value_ptr RAJA_ATOMIC_SITE_ARG(m_site));
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator--() const
   {
-    return RAJA::atomicDec<Policy>(m_value_ptr) - 1;
+    return RAJA::atomicDec<Policy>(m_value_ptr RAJA_ATOMIC_SITE_ARG(m_site))
+           - 1;
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator--(int) const
   {
-    return RAJA::atomicDec<Policy>(m_value_ptr);
+    return RAJA::atomicDec<Policy>(m_value_ptr RAJA_ATOMIC_SITE_ARG(m_site));
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type fetch_add(value_type rhs) const
   {
-    return RAJA::atomicAdd<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicAdd<Policy>(m_value_ptr,
+                                   rhs RAJA_ATOMIC_SITE_ARG(m_site));
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator+=(value_type rhs) const
   {
-    return RAJA::atomicAdd<Policy>(m_value_ptr, rhs) + rhs;
+    return RAJA::atomicAdd<Policy>(m_value_ptr,
+                                   rhs RAJA_ATOMIC_SITE_ARG(m_site))
+           + rhs;
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type fetch_sub(value_type rhs) const
   {
-    return RAJA::atomicSub<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicSub<Policy>(m_value_ptr,
+                                   rhs RAJA_ATOMIC_SITE_ARG(m_site));
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator-=(value_type rhs) const
   {
-    return RAJA::atomicSub<Policy>(m_value_ptr, rhs) - rhs;
+    return RAJA::atomicSub<Policy>(m_value_ptr,
+                                   rhs RAJA_ATOMIC_SITE_ARG(m_site))
+           - rhs;
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type fetch_min(value_type rhs) const
   {
-    return RAJA::atomicMin<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicMin<Policy>(m_value_ptr,
+                                   rhs RAJA_ATOMIC_SITE_ARG(m_site));
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type min(value_type rhs) const
   {
-    value_type old = RAJA::atomicMin<Policy>(m_value_ptr, rhs);
+    value_type old = RAJA::atomicMin<Policy>(m_value_ptr,
+                                             rhs RAJA_ATOMIC_SITE_ARG(m_site));
     return old < rhs ? old : rhs;
   }
 
@@ -444,14 +538,16 @@ public:
   RAJA_HOST_DEVICE
   value_type fetch_max(value_type rhs) const
   {
-    return RAJA::atomicMax<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicMax<Policy>(m_value_ptr,
+                                   rhs RAJA_ATOMIC_SITE_ARG(m_site));
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type max(value_type rhs) const
   {
-    value_type old = RAJA::atomicMax<Policy>(m_value_ptr, rhs);
+    value_type old = RAJA::atomicMax<Policy>(m_value_ptr,
+                                             rhs RAJA_ATOMIC_SITE_ARG(m_site));
     return old > rhs ? old : rhs;
   }
 
@@ -459,46 +555,56 @@ public:
   RAJA_HOST_DEVICE
   value_type fetch_and(value_type rhs) const
   {
-    return RAJA::atomicAnd<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicAnd<Policy>(m_value_ptr,
+                                   rhs RAJA_ATOMIC_SITE_ARG(m_site));
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator&=(value_type rhs) const
   {
-    return RAJA::atomicAnd<Policy>(m_value_ptr, rhs) & rhs;
+    return RAJA::atomicAnd<Policy>(m_value_ptr,
+                                   rhs RAJA_ATOMIC_SITE_ARG(m_site))
+           & rhs;
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type fetch_or(value_type rhs) const
   {
-    return RAJA::atomicOr<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicOr<Policy>(m_value_ptr,
+                                  rhs RAJA_ATOMIC_SITE_ARG(m_site));
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator|=(value_type rhs) const
   {
-    return RAJA::atomicOr<Policy>(m_value_ptr, rhs) | rhs;
+    return RAJA::atomicOr<Policy>(m_value_ptr,
+                                  rhs RAJA_ATOMIC_SITE_ARG(m_site))
+           | rhs;
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type fetch_xor(value_type rhs) const
   {
-    return RAJA::atomicXor<Policy>(m_value_ptr, rhs);
+    return RAJA::atomicXor<Policy>(m_value_ptr,
+                                   rhs RAJA_ATOMIC_SITE_ARG(m_site));
   }
 
   RAJA_INLINE
   RAJA_HOST_DEVICE
   value_type operator^=(value_type rhs) const
   {
-    return RAJA::atomicXor<Policy>(m_value_ptr, rhs) ^ rhs;
+    return RAJA::atomicXor<Policy>(m_value_ptr,
+                                   rhs RAJA_ATOMIC_SITE_ARG(m_site))
+           ^ rhs;
   }
 
 private:
   value_type volatile *m_value_ptr;
+  RAJA_ATOMIC_SITE_MEMBER(m_site)
 };
 
 
@@ -0,0 +1,622 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA stream compaction, partition, unique
+*          and run-length encoding declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_HPP
+#define RAJA_compact_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "camp/concepts.hpp"
+#include "camp/helpers.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/internal/Iterators.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/scan.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! number of elements handled by each task of a compaction
+constexpr Index_type compact_block_size = 4096;
+
+/*!
+ * Count the indices of each block of [0, n) for which flag is set and scan
+ * the counts, leaving the first output position of block b in offsets[b]
+ * and the total count in offsets[nblocks].  The per-element flags are
+ * never stored; the scatter pass evaluates flag again.
+ */
+template <typename ExecPolicy, typename Flag>
+Index_type compact_offsets(const ExecPolicy &p,
+                           Index_type n,
+                           Flag flag,
+                           std::vector<Index_type> &offsets)
+{
+  const Index_type nblocks =
+      (n + compact_block_size - 1) / compact_block_size;
+  offsets.assign(nblocks + 1, 0);
+  Index_type *counts = offsets.data();
+
+  forall(p, RangeSegment(0, nblocks), [=](Index_type b) {
+    const Index_type i0 = b * compact_block_size;
+    const Index_type i1 = std::min(n, i0 + compact_block_size);
+    Index_type count = 0;
+    for (Index_type i = i0; i < i1; ++i) {
+      if (flag(i)) ++count;
+    }
+    counts[b] = count;
+  });
+
+  // there are few blocks, so their counts are scanned sequentially
+  impl::scan::exclusive_inplace(seq_exec{},
+                                counts,
+                                counts + nblocks + 1,
+                                operators::plus<Index_type>{},
+                                Index_type(0));
+  return counts[nblocks];
+}
+
+/*!
+ * Scatter each block of [begin, begin + n) in order, the elements whose
+ * flag is set to out_true and the others to out_false, using the block
+ * offsets computed by compact_offsets.  With DoFalse unset only the
+ * elements whose flag is set are written.
+ */
+template <bool DoFalse,
+          typename ExecPolicy,
+          typename Iter,
+          typename TrueOut,
+          typename FalseOut,
+          typename Flag>
+void compact_scatter(const ExecPolicy &p,
+                     Iter begin,
+                     Index_type n,
+                     TrueOut out_true,
+                     FalseOut out_false,
+                     Flag flag,
+                     std::vector<Index_type> const &offsets)
+{
+  const Index_type nblocks = offsets.size() - 1;
+  const Index_type *starts = offsets.data();
+
+  forall(p, RangeSegment(0, nblocks), [=](Index_type b) {
+    const Index_type i0 = b * compact_block_size;
+    const Index_type i1 = std::min(n, i0 + compact_block_size);
+    Index_type t = starts[b];
+    Index_type f = i0 - starts[b];
+    for (Index_type i = i0; i < i1; ++i) {
+      if (flag(i)) {
+        *(out_true + t++) = *(begin + i);
+      } else if (DoFalse) {
+        *(out_false + f++) = *(begin + i);
+      }
+    }
+  });
+}
+
+//! move [0, n) of from back to to in parallel
+template <typename ExecPolicy, typename T, typename Iter>
+void move_back(const ExecPolicy &p, T *from, Index_type n, Iter to)
+{
+  forall(p, RangeSegment(0, n), [=](Index_type i) {
+    *(to + i) = std::move(from[i]);
+  });
+}
+
+template <typename Predicate>
+struct not_pred {
+  Predicate pred;
+
+  template <typename T>
+  RAJA_INLINE bool operator()(T &&v) const
+  {
+    return !pred(std::forward<T>(v));
+  }
+};
+
+//! flag of element i: whether it satisfies pred
+template <typename Iter, typename Predicate>
+struct value_flag {
+  Iter begin;
+  Predicate pred;
+
+  RAJA_INLINE bool operator()(Index_type i) const { return pred(*(begin + i)); }
+};
+
+//! flag of element i: whether it starts a run of equal elements
+template <typename Iter, typename Equal>
+struct run_start_flag {
+  Iter begin;
+  Equal eq;
+
+  RAJA_INLINE bool operator()(Index_type i) const
+  {
+    return i == 0 || !eq(*(begin + (i - 1)), *(begin + i));
+  }
+};
+
+}  // end namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  copy-if execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator receiving the elements
+*that satisfy pred, in their original order
+* \param[in] pred unary predicate
+*
+* \return the number of elements copied
+*
+* \note{The range of [begin, end) must be separate from the output}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value
+                            && type_traits::is_iterator<IterOut>::value,
+                        Index_type>::type
+copy_if(const ExecPolicy &p,
+        Iter begin,
+        Iter end,
+        IterOut out,
+        Predicate pred)
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  const Index_type n = end - begin;
+  if (n <= 0) return 0;
+
+  const detail::value_flag<Iter, Predicate> flag{begin, pred};
+  std::vector<Index_type> offsets;
+  const Index_type count = detail::compact_offsets(p, n, flag, offsets);
+  detail::compact_scatter<false>(p, begin, n, out, out, flag, offsets);
+  return count;
+}
+
+/*!
+******************************************************************************
+*
+* \brief  remove-if execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data
+*range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] pred unary predicate
+*
+* \return the number of elements kept; [begin, begin + count) holds the
+*elements that do not satisfy pred, in their original order
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value,
+                        Index_type>::type
+remove_if(const ExecPolicy &p, Iter begin, Iter end, Predicate pred)
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  using T = detail::IterVal<Iter>;
+  const Index_type n = end - begin;
+  if (n <= 0) return 0;
+
+  const detail::value_flag<Iter, detail::not_pred<Predicate>> keep{
+      begin, detail::not_pred<Predicate>{pred}};
+  std::vector<Index_type> offsets;
+  const Index_type count = detail::compact_offsets(p, n, keep, offsets);
+  if (count == n) return count;
+
+  std::vector<T> kept(count);
+  detail::compact_scatter<false>(
+      p, begin, n, kept.data(), kept.data(), keep, offsets);
+  detail::move_back(p, kept.data(), count, begin);
+  return count;
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable partition execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data
+*range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] pred unary predicate
+*
+* \return the number of elements that satisfy pred; they are moved to the
+*front of the range, and the relative order within both groups is kept
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value,
+                        Index_type>::type
+stable_partition(const ExecPolicy &p, Iter begin, Iter end, Predicate pred)
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  using T = detail::IterVal<Iter>;
+  const Index_type n = end - begin;
+  if (n <= 0) return 0;
+
+  const detail::value_flag<Iter, Predicate> flag{begin, pred};
+  std::vector<Index_type> offsets;
+  const Index_type count = detail::compact_offsets(p, n, flag, offsets);
+  if (count == 0 || count == n) return count;
+
+  std::vector<T> parts(n);
+  detail::compact_scatter<true>(
+      p, begin, n, parts.data(), parts.data() + count, flag, offsets);
+  detail::move_back(p, parts.data(), n, begin);
+  return count;
+}
+
+/*!
+******************************************************************************
+*
+* \brief  partition execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data
+*range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] pred unary predicate
+*
+* \return the number of elements that satisfy pred, which are moved to the
+*front of the range
+*
+* \note{The current implementation is the stable partition}
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value,
+                        Index_type>::type
+partition(const ExecPolicy &p, Iter begin, Iter end, Predicate pred)
+{
+  return RAJA::stable_partition(p, begin, end, pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  unique copy execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator receiving the first
+*element of every run of equal elements, in their original order
+* \param[in] eq equality predicate
+*
+* \return the number of elements copied
+*
+* \note{The range of [begin, end) must be separate from the output}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename Equal = operators::equal_to<detail::IterVal<Iter>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value
+                            && type_traits::is_iterator<IterOut>::value,
+                        Index_type>::type
+unique_copy(const ExecPolicy &p,
+            Iter begin,
+            Iter end,
+            IterOut out,
+            Equal eq = Equal{})
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  const Index_type n = end - begin;
+  if (n <= 0) return 0;
+
+  const detail::run_start_flag<Iter, Equal> flag{begin, eq};
+  std::vector<Index_type> offsets;
+  const Index_type count = detail::compact_offsets(p, n, flag, offsets);
+  detail::compact_scatter<false>(p, begin, n, out, out, flag, offsets);
+  return count;
+}
+
+/*!
+******************************************************************************
+*
+* \brief  unique execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data
+*range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] eq equality predicate
+*
+* \return the number of elements kept; [begin, begin + count) holds the
+*first element of every run of equal elements, in their original order
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Equal = operators::equal_to<detail::IterVal<Iter>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value,
+                        Index_type>::type
+unique(const ExecPolicy &p, Iter begin, Iter end, Equal eq = Equal{})
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  using T = detail::IterVal<Iter>;
+  const Index_type n = end - begin;
+  if (n <= 0) return 0;
+
+  const detail::run_start_flag<Iter, Equal> flag{begin, eq};
+  std::vector<Index_type> offsets;
+  const Index_type count = detail::compact_offsets(p, n, flag, offsets);
+  if (count == n) return count;
+
+  std::vector<T> kept(count);
+  detail::compact_scatter<false>(
+      p, begin, n, kept.data(), kept.data(), flag, offsets);
+  detail::move_back(p, kept.data(), count, begin);
+  return count;
+}
+
+/*!
+******************************************************************************
+*
+* \brief  run-length encode execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] unique_out Pointer or Random-Access Iterator receiving the
+*first element of every run of equal elements
+* \param[out] counts_out Pointer or Random-Access Iterator receiving the
+*length of every run
+* \param[in] eq equality predicate
+*
+* \return the number of runs
+*
+* \note{The range of [begin, end) must be separate from the outputs}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename CountOut,
+          typename Equal = operators::equal_to<detail::IterVal<Iter>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value
+                            && type_traits::is_iterator<IterOut>::value
+                            && type_traits::is_iterator<CountOut>::value,
+                        Index_type>::type
+run_length_encode(const ExecPolicy &p,
+                  Iter begin,
+                  Iter end,
+                  IterOut unique_out,
+                  CountOut counts_out,
+                  Equal eq = Equal{})
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<CountOut>::value,
+                "Count Iterator must model RandomAccessIterator");
+  using Count = detail::IterVal<CountOut>;
+  const Index_type n = end - begin;
+  if (n <= 0) return 0;
+
+  // the positions of the run starts give both outputs
+  const detail::run_start_flag<Iter, Equal> flag{begin, eq};
+  std::vector<Index_type> offsets;
+  const Index_type runs = detail::compact_offsets(p, n, flag, offsets);
+  std::vector<Index_type> starts(runs + 1);
+  detail::compact_scatter<false>(p,
+                                 Iterators::numeric_iterator<Index_type>(0),
+                                 n,
+                                 starts.data(),
+                                 starts.data(),
+                                 flag,
+                                 offsets);
+  starts[runs] = n;
+
+  const Index_type *s = starts.data();
+  forall(p, RangeSegment(0, runs), [=](Index_type r) {
+    *(unique_out + r) = *(begin + s[r]);
+    *(counts_out + r) = static_cast<Count>(s[r + 1] - s[r]);
+  });
+  return runs;
+}
+
+// =============================================================================
+
+template <typename ExecPolicy,
+          typename Container,
+          typename IterOut,
+          typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        Index_type>::type
+copy_if(const ExecPolicy &p, Container &c, IterOut out, Predicate pred)
+{
+  return RAJA::copy_if(p, std::begin(c), std::end(c), out, pred);
+}
+
+template <typename ExecPolicy, typename Container, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        Index_type>::type
+remove_if(const ExecPolicy &p, Container &c, Predicate pred)
+{
+  return RAJA::remove_if(p, std::begin(c), std::end(c), pred);
+}
+
+template <typename ExecPolicy, typename Container, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        Index_type>::type
+stable_partition(const ExecPolicy &p, Container &c, Predicate pred)
+{
+  return RAJA::stable_partition(p, std::begin(c), std::end(c), pred);
+}
+
+template <typename ExecPolicy, typename Container, typename Predicate>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        Index_type>::type
+partition(const ExecPolicy &p, Container &c, Predicate pred)
+{
+  return RAJA::partition(p, std::begin(c), std::end(c), pred);
+}
+
+template <typename ExecPolicy,
+          typename Container,
+          typename IterOut,
+          typename Equal = operators::equal_to<detail::ContainerVal<Container>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        Index_type>::type
+unique_copy(const ExecPolicy &p, Container &c, IterOut out, Equal eq = Equal{})
+{
+  return RAJA::unique_copy(p, std::begin(c), std::end(c), out, eq);
+}
+
+template <typename ExecPolicy,
+          typename Container,
+          typename Equal = operators::equal_to<detail::ContainerVal<Container>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        Index_type>::type
+unique(const ExecPolicy &p, Container &c, Equal eq = Equal{})
+{
+  return RAJA::unique(p, std::begin(c), std::end(c), eq);
+}
+
+template <typename ExecPolicy,
+          typename Container,
+          typename IterOut,
+          typename CountOut,
+          typename Equal = operators::equal_to<detail::ContainerVal<Container>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        Index_type>::type
+run_length_encode(const ExecPolicy &p,
+                  Container &c,
+                  IterOut unique_out,
+                  CountOut counts_out,
+                  Equal eq = Equal{})
+{
+  return RAJA::run_length_encode(
+      p, std::begin(c), std::end(c), unique_out, counts_out, eq);
+}
+
+template <typename ExecPolicy, typename... Args>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value,
+                        Index_type>::type
+copy_if(Args &&... args)
+{
+  return RAJA::copy_if(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value,
+                        Index_type>::type
+remove_if(Args &&... args)
+{
+  return RAJA::remove_if(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value,
+                        Index_type>::type
+stable_partition(Args &&... args)
+{
+  return RAJA::stable_partition(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value,
+                        Index_type>::type
+partition(Args &&... args)
+{
+  return RAJA::partition(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value,
+                        Index_type>::type
+unique_copy(Args &&... args)
+{
+  return RAJA::unique_copy(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value,
+                        Index_type>::type
+unique(Args &&... args)
+{
+  return RAJA::unique(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value,
+                        Index_type>::type
+run_length_encode(Args &&... args)
+{
+  return RAJA::run_length_encode(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,306 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Internal header for forall loops that take reduction parameters.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_FORALL_PARAM_HPP
+#define RAJA_PATTERN_DETAIL_FORALL_PARAM_HPP
+
+#include "RAJA/config.hpp"
+
+#include <mutex>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/internal/LegacyCompatibility.hpp"
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/detail/reduce.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Accumulators of one reduction parameter for each of Lanes SIMD lanes,
+ * kept contiguous so a vectorized loop updates them with unit stride.
+ */
+template <typename T, camp::idx_t Lanes>
+struct ForallParamLanes {
+  T value[Lanes];
+
+  RAJA_INLINE T load(camp::idx_t l) const { return value[l]; }
+  RAJA_INLINE void store(camp::idx_t l, T const& v) { value[l] = v; }
+};
+
+/*!
+ * Lane accumulators of a min-loc or max-loc parameter, with the values and
+ * the locations in separate arrays.
+ */
+template <typename LocValue, camp::idx_t Lanes>
+struct ForallLocLanes {
+  typename LocValue::data_type val[Lanes];
+  typename LocValue::index_type loc[Lanes];
+
+  RAJA_INLINE LocValue load(camp::idx_t l) const
+  {
+    return LocValue{val[l], loc[l]};
+  }
+  RAJA_INLINE void store(camp::idx_t l, LocValue const& v)
+  {
+    val[l] = v.val;
+    loc[l] = v.loc;
+  }
+};
+
+
+/*!
+ * A reduction parameter of forall_param: the loop body receives a
+ * reference to a thread-private value of type T which starts at the
+ * identity of Op, and the private values are combined into *target when
+ * the loop completes.
+ */
+template <typename T, template <typename...> class Op>
+struct ForallReduceParam {
+  using value_type = T;
+  using combiner_t = RAJA::reduce::detail::op_adapter<T, Op>;
+
+  template <camp::idx_t Lanes>
+  using lanes_type = ForallParamLanes<T, Lanes>;
+
+  T* target;
+
+  static constexpr T identity() { return combiner_t::identity(); }
+
+  static RAJA_INLINE void combine(T& val, T const& v) { combiner_t{}(val, v); }
+
+  void combine_into_target(T const& v) const { combine(*target, v); }
+};
+
+
+/*!
+ * A min-loc or max-loc reduction parameter of forall_param.  LocValue is a
+ * MinLocValue or MaxLocValue; values that compare equal resolve to the
+ * smaller location, so the result does not depend on how the iterations
+ * were split between threads or SIMD lanes.
+ */
+template <typename LocValue>
+struct ForallLocParam {
+  using value_type = LocValue;
+  using data_type = typename LocValue::data_type;
+  using index_type = typename LocValue::index_type;
+
+  template <camp::idx_t Lanes>
+  using lanes_type = ForallLocLanes<LocValue, Lanes>;
+
+  data_type* target;
+  index_type* target_loc;
+
+  static constexpr value_type identity()
+  {
+    return value_type{LocValue::identity_value(),
+                      RAJA::reduce::detail::DefaultLoc<index_type>().value()};
+  }
+
+  static RAJA_INLINE void combine(value_type& val, value_type const& v)
+  {
+    if (LocValue::before(v.val, val.val)
+        || (!LocValue::before(val.val, v.val) && v.loc < val.loc)) {
+      val = v;
+    }
+  }
+
+  void combine_into_target(value_type const& v) const
+  {
+    value_type val{*target, *target_loc};
+    combine(val, v);
+    *target = val.val;
+    *target_loc = val.loc;
+  }
+};
+
+
+template <typename Wrapper>
+struct ForallParamPrivatizer;
+
+/*!
+ * Loop body wrapper handed to forall_impl by forall_param.
+ *
+ * The wrapper refers to accumulators owned by a ForallParamPrivatizer, so
+ * copies made by a backend all update the same values and thread_privatize
+ * gives each thread (or TBB chunk) a fresh set of accumulators.
+ */
+template <typename ParamTuple, typename LoopBody>
+struct ForallParamWrapper;
+
+template <typename... Params, typename LoopBody>
+struct ForallParamWrapper<camp::tuple<Params...>, LoopBody> {
+
+  using param_tuple_t = camp::tuple<Params...>;
+  using value_tuple_t = camp::tuple<typename Params::value_type...>;
+  using body_t = LoopBody;
+  using privatizer = ForallParamPrivatizer<ForallParamWrapper>;
+  using param_seq_t = camp::make_idx_seq_t<sizeof...(Params)>;
+
+  param_tuple_t params;
+  value_tuple_t& values;
+  body_t body;
+
+  template <typename Index>
+  RAJA_INLINE void operator()(Index&& i)
+  {
+    invoke(std::forward<Index>(i), param_seq_t{});
+  }
+
+  /*!
+   * Run the loop over [0, distance) of begin with Lanes independent sets of
+   * accumulators, so the loop body has no dependence between neighbouring
+   * iterations; the lanes are combined horizontally at the end.
+   */
+  template <camp::idx_t Lanes, typename Iterator, typename Distance>
+  RAJA_INLINE void exec_lanes(Iterator begin, Distance distance)
+  {
+    exec_lanes<Lanes>(begin, distance, param_seq_t{});
+  }
+
+  static value_tuple_t identities()
+  {
+    return value_tuple_t(Params::identity()...);
+  }
+
+  //! combine a set of private values into the reduction targets
+  void combine(value_tuple_t const& vals) const
+  {
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    combine(vals, param_seq_t{});
+  }
+
+private:
+  template <typename Index, camp::idx_t... Is>
+  RAJA_INLINE void invoke(Index&& i, camp::idx_seq<Is...>)
+  {
+    body(std::forward<Index>(i), camp::get<Is>(values)...);
+  }
+
+  //! run one iteration on copies of the accumulators of lane l
+  template <typename LaneTuple,
+            typename Index,
+            camp::idx_t... Is,
+            typename... Values>
+  RAJA_INLINE void invoke_lane(LaneTuple& lanes,
+                               camp::idx_t l,
+                               Index&& i,
+                               camp::idx_seq<Is...>,
+                               Values... vals)
+  {
+    body(std::forward<Index>(i), vals...);
+    VarOps::ignore_args((camp::get<Is>(lanes).store(l, vals), 0)...);
+  }
+
+  template <camp::idx_t Lanes,
+            typename Iterator,
+            typename Distance,
+            camp::idx_t... Is>
+  RAJA_INLINE void exec_lanes(Iterator begin,
+                              Distance distance,
+                              camp::idx_seq<Is...>)
+  {
+    camp::tuple<typename Params::template lanes_type<Lanes>...> lanes;
+    for (camp::idx_t l = 0; l < Lanes; ++l) {
+      VarOps::ignore_args(
+          (camp::get<Is>(lanes).store(l, Params::identity()), 0)...);
+    }
+
+    Distance full = distance - distance % Lanes;
+    for (Distance base = 0; base < full; base += Lanes) {
+      RAJA_SIMD
+      for (camp::idx_t l = 0; l < Lanes; ++l) {
+        invoke_lane(lanes,
+                    l,
+                    *(begin + (base + l)),
+                    camp::idx_seq<Is...>{},
+                    camp::get<Is>(lanes).load(l)...);
+      }
+    }
+    for (Distance i = full; i < distance; ++i) {
+      body(*(begin + i), camp::get<Is>(values)...);
+    }
+
+    for (camp::idx_t l = 0; l < Lanes; ++l) {
+      VarOps::ignore_args(
+          (Params::combine(camp::get<Is>(values), camp::get<Is>(lanes).load(l)),
+           0)...);
+    }
+  }
+
+  template <camp::idx_t... Is>
+  void combine(value_tuple_t const& vals, camp::idx_seq<Is...>) const
+  {
+    VarOps::ignore_args(
+        (camp::get<Is>(params).combine_into_target(camp::get<Is>(vals)), 0)...);
+  }
+};
+
+
+/*!
+ * Owns one set of accumulators for a ForallParamWrapper and combines them
+ * into the reduction targets when destroyed, which happens once per thread
+ * or chunk for backends that call thread_privatize and once per loop
+ * otherwise.
+ */
+template <typename Wrapper>
+struct ForallParamPrivatizer {
+  using value_type = Wrapper;
+  using reference_type = value_type&;
+  using value_tuple_t = typename Wrapper::value_tuple_t;
+
+  value_tuple_t values;
+  value_type wrapper;
+
+  ForallParamPrivatizer(typename Wrapper::param_tuple_t const& params,
+                        typename Wrapper::body_t const& body)
+      : values(Wrapper::identities()), wrapper{params, values, body}
+  {
+  }
+
+  ForallParamPrivatizer(Wrapper const& o)
+      : ForallParamPrivatizer(o.params, o.body)
+  {
+  }
+
+  //! copies start from the identity so that no value is combined twice
+  ForallParamPrivatizer(ForallParamPrivatizer const& o)
+      : ForallParamPrivatizer(o.wrapper.params, o.wrapper.body)
+  {
+  }
+
+  ForallParamPrivatizer& operator=(ForallParamPrivatizer const&) = delete;
+
+  ~ForallParamPrivatizer() { wrapper.combine(values); }
+
+  reference_type get_priv() { return wrapper; }
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_FORALL_PARAM_HPP */
@@ -18,6 +18,11 @@
 #ifndef RAJA_PATTERN_DETAIL_REDUCE_HPP
 #define RAJA_PATTERN_DETAIL_REDUCE_HPP
 
+#include <cstddef>
+#include <type_traits>
+
+#include "camp/tuple.hpp"
+
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -41,12 +46,40 @@
     using Base::Base;                                                    \
   };
 
+#define RAJA_DECLARE_K_REDUCER(OP, POL, COMBINER)                           \
+  template <typename T, typename IndexType, size_t K>                       \
+  class Reduce##OP<POL, T, IndexType, K>                                    \
+      : public reduce::detail::BaseReduce##OP<T, IndexType, K, COMBINER>    \
+  {                                                                         \
+  public:                                                                   \
+    using Base = reduce::detail::BaseReduce##OP<T, IndexType, K, COMBINER>; \
+    using Base::Base;                                                       \
+  };
+
+#define RAJA_DECLARE_OP_REDUCER(POL, COMBINER)                     \
+  template <typename T, typename Op>                               \
+  class Reduce<POL, T, Op>                                         \
+      : public reduce::detail::BaseReduceOp<T, Op, COMBINER>       \
+  {                                                                \
+  public:                                                          \
+    using Base = reduce::detail::BaseReduceOp<T, Op, COMBINER>;    \
+    using Base::Base;                                              \
+  };
+
 #define RAJA_DECLARE_ALL_REDUCERS(POL, COMBINER)       \
   RAJA_DECLARE_REDUCER(Sum, POL, COMBINER)             \
   RAJA_DECLARE_REDUCER(Min, POL, COMBINER)             \
   RAJA_DECLARE_REDUCER(Max, POL, COMBINER)             \
   RAJA_DECLARE_INDEX_REDUCER(MinLoc, POL, COMBINER)    \
-  RAJA_DECLARE_INDEX_REDUCER(MaxLoc, POL, COMBINER)
+  RAJA_DECLARE_INDEX_REDUCER(MaxLoc, POL, COMBINER)    \
+  RAJA_DECLARE_K_REDUCER(MinK, POL, COMBINER)          \
+  RAJA_DECLARE_K_REDUCER(MaxK, POL, COMBINER)          \
+  RAJA_DECLARE_REDUCER(Prod, POL, COMBINER)            \
+  RAJA_DECLARE_REDUCER(BitOr, POL, COMBINER)           \
+  RAJA_DECLARE_REDUCER(BitAnd, POL, COMBINER)          \
+  RAJA_DECLARE_REDUCER(LogicalOr, POL, COMBINER)       \
+  RAJA_DECLARE_REDUCER(LogicalAnd, POL, COMBINER)      \
+  RAJA_DECLARE_OP_REDUCER(POL, COMBINER)
 
 namespace RAJA
 {
@@ -74,6 +107,31 @@ struct op_adapter : private Op<T, T, T> {
     val = operator_type::operator()(val, v);
   }
 };
+
+/*!
+ * Adapts a fully specified operator functor (any RAJA::operators type that
+ * provides identity()) to the interface expected by the reducer combiners.
+ */
+template <typename T, typename Op>
+struct functor_adapter : private Op {
+  using operator_type = Op;
+  RAJA_HOST_DEVICE static constexpr T identity()
+  {
+    return operator_type::identity();
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(T &val, const T v) const
+  {
+    val = operator_type::operator()(val, v);
+  }
+};
+
+//! binds an operator functor so it may be used as a Reduce_ template
+template <typename Op>
+struct bind_op {
+  template <typename T>
+  using type = functor_adapter<T, Op>;
+};
 }  // namespace detail
 
 template <typename T>
@@ -88,6 +146,28 @@ template <typename T>
 struct max : detail::op_adapter<T, RAJA::operators::maximum> {
 };
 
+template <typename T>
+struct prod : detail::op_adapter<T, RAJA::operators::multiplies> {
+};
+
+template <typename T>
+struct bit_or : detail::op_adapter<T, RAJA::operators::bit_or> {
+};
+
+template <typename T>
+struct bit_and : detail::op_adapter<T, RAJA::operators::bit_and> {
+};
+
+template <typename T>
+struct logical_or
+    : detail::functor_adapter<T, RAJA::operators::logical_or<T>> {
+};
+
+template <typename T>
+struct logical_and
+    : detail::functor_adapter<T, RAJA::operators::logical_and<T>> {
+};
+
 #if defined(RAJA_RAJA_ENABLE_TARGET_OPENMP)
 #pragma omp end declare target
 #endif
@@ -110,6 +190,19 @@ struct DefaultLoc<T, true>
   RAJA_HOST_DEVICE constexpr T value() const { return -1; }
 };
 
+/*!
+ * Multi-dimensional locations default each component independently, so a
+ * tuple of integral indices defaults to (-1, -1, ...).
+ */
+template <typename... Ts>
+struct DefaultLoc<camp::tuple<Ts...>, false>
+{
+  RAJA_HOST_DEVICE constexpr camp::tuple<Ts...> value() const
+  {
+    return camp::tuple<Ts...>(DefaultLoc<Ts>().value()...);
+  }
+};
+
 template <typename T, typename IndexType, bool doing_min = true>
 class ValueLoc
 {
@@ -146,6 +239,100 @@ public:
   }
 };
 
+/*!
+ * The K best (value, location) pairs seen so far, best first.  Pairs with
+ * equal values are ordered by location so the result does not depend on
+ * the order in which the pairs were inserted or merged.  An empty list is
+ * the identity of merge().
+ */
+template <typename T, typename IndexType, size_t K, bool doing_min = true>
+class ValueLocK
+{
+  static_assert(K > 0, "ValueLocK needs room for at least one entry");
+
+  T vals[K];
+  IndexType locs[K];
+  size_t count = 0;
+
+  static bool before(T const &a, IndexType const &a_loc,
+                     T const &b, IndexType const &b_loc)
+  {
+    if (doing_min ? a < b : b < a) return true;
+    if (doing_min ? b < a : a < b) return false;
+    return a_loc < b_loc;
+  }
+
+public:
+  using value_type = ValueLoc<T, IndexType, doing_min>;
+
+  //! number of entries held, at most K
+  size_t size() const { return count; }
+
+  static constexpr size_t capacity() { return K; }
+
+  //! the j-th best entry
+  value_type operator[](size_t j) const { return value_type(vals[j], locs[j]); }
+
+  T const &value(size_t j) const { return vals[j]; }
+
+  IndexType const &getLoc(size_t j) const { return locs[j]; }
+
+  //! add one pair, dropping the worst entry if the list is full
+  void insert(T const &v, IndexType const &loc)
+  {
+    if (count == K && !before(v, loc, vals[K - 1], locs[K - 1])) return;
+    size_t j = count < K ? count++ : K - 1;
+    for (; j > 0 && before(v, loc, vals[j - 1], locs[j - 1]); --j) {
+      vals[j] = vals[j - 1];
+      locs[j] = locs[j - 1];
+    }
+    vals[j] = v;
+    locs[j] = loc;
+  }
+
+  //! keep the K best entries of this list and other
+  void merge(ValueLocK const &other)
+  {
+    ValueLocK out;
+    size_t a = 0, b = 0;
+    while (out.count < K && (a < count || b < other.count)) {
+      bool take_other = a == count
+                        || (b < other.count
+                            && before(other.vals[b],
+                                      other.locs[b],
+                                      vals[a],
+                                      locs[a]));
+      if (take_other) {
+        out.vals[out.count] = other.vals[b];
+        out.locs[out.count++] = other.locs[b++];
+      } else {
+        out.vals[out.count] = vals[a];
+        out.locs[out.count++] = locs[a++];
+      }
+    }
+    *this = out;
+  }
+
+  bool operator==(ValueLocK const &rhs) const
+  {
+    if (count != rhs.count) return false;
+    for (size_t j = 0; j < count; ++j) {
+      if (vals[j] != rhs.vals[j] || !(locs[j] == rhs.locs[j])) return false;
+    }
+    return true;
+  }
+
+  bool operator!=(ValueLocK const &rhs) const { return !(*this == rhs); }
+};
+
+//! reduction operator of ValueLocK; the empty list is the identity
+template <typename T>
+struct merge_k {
+  static T identity() { return T(); }
+
+  void operator()(T &val, const T v) const { val.merge(v); }
+};
+
 }  // namespace detail
 
 }  // namespace reduce
@@ -352,6 +539,16 @@ public:
     return *this;
   }
 
+  /// \brief reducer function taking each component of a multi-dimensional
+  ///        location, e.g. minloc(val, i, j) for a tuple IndexType
+  template <typename... Locs,
+            typename = typename std::enable_if<(sizeof...(Locs) > 1)>::type>
+  const BaseReduceMinLoc &minloc(T rhs, Locs... locs) const
+  {
+    this->combine(value_type(rhs, IndexType(locs...)));
+    return *this;
+  }
+
   //! Get the calculated reduced value
   IndexType getLoc() const { return Base::get().getLoc(); }
 
@@ -435,6 +632,15 @@ public:
     return *this;
   }
 
+  //! reducer function taking each component of a multi-dimensional location
+  template <typename... Locs,
+            typename = typename std::enable_if<(sizeof...(Locs) > 1)>::type>
+  const BaseReduceMaxLoc &maxloc(T rhs, Locs... locs) const
+  {
+    this->combine(value_type(rhs, IndexType(locs...)));
+    return *this;
+  }
+
   //! Get the calculated reduced value
   IndexType getLoc() const { return Base::get().getLoc(); }
 
@@ -442,6 +648,215 @@ public:
   operator T() const { return Base::get(); }
 };
 
+/*!
+ **************************************************************************
+ *
+ * \brief  Product reducer class template.
+ *
+ **************************************************************************
+ */
+template <typename T, template <typename, typename> class Combiner>
+class BaseReduceProd : public BaseReduce<T, RAJA::reduce::prod, Combiner>
+{
+public:
+  using Base = BaseReduce<T, RAJA::reduce::prod, Combiner>;
+  using Base::Base;
+
+  BaseReduceProd() : Base(RAJA::reduce::prod<T>::identity()) {}
+
+  //! reducer function; updates the current instance's state
+  const BaseReduceProd &operator*=(T rhs) const
+  {
+    this->combine(rhs);
+    return *this;
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Bitwise-or reducer class template.
+ *
+ **************************************************************************
+ */
+template <typename T, template <typename, typename> class Combiner>
+class BaseReduceBitOr : public BaseReduce<T, RAJA::reduce::bit_or, Combiner>
+{
+public:
+  using Base = BaseReduce<T, RAJA::reduce::bit_or, Combiner>;
+  using Base::Base;
+
+  BaseReduceBitOr() : Base(RAJA::reduce::bit_or<T>::identity()) {}
+
+  //! reducer function; updates the current instance's state
+  const BaseReduceBitOr &operator|=(T rhs) const
+  {
+    this->combine(rhs);
+    return *this;
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Bitwise-and reducer class template.
+ *
+ **************************************************************************
+ */
+template <typename T, template <typename, typename> class Combiner>
+class BaseReduceBitAnd : public BaseReduce<T, RAJA::reduce::bit_and, Combiner>
+{
+public:
+  using Base = BaseReduce<T, RAJA::reduce::bit_and, Combiner>;
+  using Base::Base;
+
+  BaseReduceBitAnd() : Base(RAJA::reduce::bit_and<T>::identity()) {}
+
+  //! reducer function; updates the current instance's state
+  const BaseReduceBitAnd &operator&=(T rhs) const
+  {
+    this->combine(rhs);
+    return *this;
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Logical-or reducer class template.
+ *
+ **************************************************************************
+ */
+template <typename T, template <typename, typename> class Combiner>
+class BaseReduceLogicalOr
+    : public BaseReduce<T, RAJA::reduce::logical_or, Combiner>
+{
+public:
+  using Base = BaseReduce<T, RAJA::reduce::logical_or, Combiner>;
+  using Base::Base;
+
+  BaseReduceLogicalOr() : Base(RAJA::reduce::logical_or<T>::identity()) {}
+
+  //! reducer function; updates the current instance's state
+  const BaseReduceLogicalOr &logical_or(T rhs) const
+  {
+    this->combine(rhs);
+    return *this;
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Logical-and reducer class template.
+ *
+ **************************************************************************
+ */
+template <typename T, template <typename, typename> class Combiner>
+class BaseReduceLogicalAnd
+    : public BaseReduce<T, RAJA::reduce::logical_and, Combiner>
+{
+public:
+  using Base = BaseReduce<T, RAJA::reduce::logical_and, Combiner>;
+  using Base::Base;
+
+  BaseReduceLogicalAnd() : Base(RAJA::reduce::logical_and<T>::identity()) {}
+
+  //! reducer function; updates the current instance's state
+  const BaseReduceLogicalAnd &logical_and(T rhs) const
+  {
+    this->combine(rhs);
+    return *this;
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Reducer class template keeping the K smallest values and their
+ *         locations.
+ *
+ **************************************************************************
+ */
+template <typename T,
+          typename IndexType,
+          size_t K,
+          template <typename, typename> class Combiner>
+class BaseReduceMinK
+    : public BaseReduce<ValueLocK<T, IndexType, K>, merge_k, Combiner>
+{
+public:
+  using Base = BaseReduce<ValueLocK<T, IndexType, K>, merge_k, Combiner>;
+  using Base::Base;
+
+  BaseReduceMinK() : Base(ValueLocK<T, IndexType, K>()) {}
+
+  //! reducer function; offers a candidate to the current instance
+  const BaseReduceMinK &minloc(T rhs, IndexType loc) const
+  {
+    this->local().insert(rhs, loc);
+    return *this;
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Reducer class template keeping the K largest values and their
+ *         locations.
+ *
+ **************************************************************************
+ */
+template <typename T,
+          typename IndexType,
+          size_t K,
+          template <typename, typename> class Combiner>
+class BaseReduceMaxK
+    : public BaseReduce<ValueLocK<T, IndexType, K, false>, merge_k, Combiner>
+{
+public:
+  using Base =
+      BaseReduce<ValueLocK<T, IndexType, K, false>, merge_k, Combiner>;
+  using Base::Base;
+
+  BaseReduceMaxK() : Base(ValueLocK<T, IndexType, K, false>()) {}
+
+  //! reducer function; offers a candidate to the current instance
+  const BaseReduceMaxK &maxloc(T rhs, IndexType loc) const
+  {
+    this->local().insert(rhs, loc);
+    return *this;
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Reducer class template for an arbitrary operator functor.
+ *
+ *         Op is a fully specified functor, e.g. RAJA::operators::bit_or<int>,
+ *         that provides a static identity() method.
+ *
+ **************************************************************************
+ */
+template <typename T, typename Op, template <typename, typename> class Combiner>
+class BaseReduceOp
+    : public BaseReduce<T, bind_op<Op>::template type, Combiner>
+{
+public:
+  using Base = BaseReduce<T, bind_op<Op>::template type, Combiner>;
+  using Base::Base;
+
+  BaseReduceOp() : Base(Op::identity()) {}
+
+  //! reducer function; updates the current instance's state
+  const BaseReduceOp &reduce(T rhs) const
+  {
+    this->combine(rhs);
+    return *this;
+  }
+};
+
 }  // namespace detail
 
 }  // namespace reduce
@@ -0,0 +1,440 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Internal header with the building blocks of scans and segmented
+ *          reductions shared by the execution backends.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_SCAN_HPP
+#define RAJA_PATTERN_DETAIL_SCAN_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Scan [i0, i1) of in into out, continuing from agg, the reduction of the
+ * values before i0; returns the reduction including the block.  out may
+ * alias in.
+ */
+template <bool Exclusive,
+          typename Value,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+RAJA_INLINE Value scan_block(Iter in,
+                             OutIter out,
+                             Index_type i0,
+                             Index_type i1,
+                             BinFn f,
+                             Value agg,
+                             std::false_type)
+{
+  for (Index_type i = i0; i < i1; ++i) {
+    if (Exclusive) {
+      const Value v = *(in + i);
+      *(out + i) = agg;
+      agg = f(agg, v);
+    } else {
+      agg = f(agg, *(in + i));
+      *(out + i) = agg;
+    }
+  }
+  return agg;
+}
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_shufflevector)
+#define RAJA_SIMD_SCAN_SHUFFLE
+#endif
+#endif
+
+#if defined(RAJA_SIMD_SCAN_SHUFFLE)
+
+/*!
+ * Operators with an in-register scan, with their lane-wise form on vector
+ * extension types.  Integer sums, minima and maxima give the same result
+ * whatever the order of evaluation; floating point sums would round
+ * differently, and floating point minima and maxima would treat NaNs
+ * differently, from the scalar scan, so they do not use it.
+ */
+template <typename BinFn>
+struct simd_scan_op;
+
+template <typename T>
+struct simd_scan_op<operators::plus<T>> {
+  template <typename V>
+  static RAJA_INLINE V apply(V a, V b)
+  {
+    return a + b;
+  }
+};
+
+template <typename T>
+struct simd_scan_op<operators::minimum<T>> {
+  template <typename V>
+  static RAJA_INLINE V apply(V a, V b)
+  {
+    return (b < a) ? b : a;
+  }
+};
+
+template <typename T>
+struct simd_scan_op<operators::maximum<T>> {
+  template <typename V>
+  static RAJA_INLINE V apply(V a, V b)
+  {
+    return (a < b) ? b : a;
+  }
+};
+
+template <typename BinFn, typename T>
+struct is_simd_scan_op : std::false_type {
+};
+
+template <typename T>
+struct is_simd_scan_op<operators::plus<T>, T> : std::is_integral<T> {
+};
+
+template <typename T>
+struct is_simd_scan_op<operators::minimum<T>, T> : std::is_integral<T> {
+};
+
+template <typename T>
+struct is_simd_scan_op<operators::maximum<T>, T> : std::is_integral<T> {
+};
+
+//! 16 byte vector of T, 4 lanes of 32 bit or 2 lanes of 64 bit values
+template <typename T>
+struct simd_scan_vector {
+  typedef T type __attribute__((vector_size(16)));
+  static constexpr int lanes = 16 / sizeof(T);
+};
+
+/*!
+ * Vector v shifted up by S lanes, with the lanes at the bottom taken from
+ * fill.
+ */
+template <int W, int S>
+struct simd_scan_shift;
+
+template <>
+struct simd_scan_shift<4, 1> {
+  template <typename V>
+  static RAJA_INLINE V apply(V fill, V v)
+  {
+    return __builtin_shufflevector(fill, v, 0, 4, 5, 6);
+  }
+};
+
+template <>
+struct simd_scan_shift<4, 2> {
+  template <typename V>
+  static RAJA_INLINE V apply(V fill, V v)
+  {
+    return __builtin_shufflevector(fill, v, 0, 1, 4, 5);
+  }
+};
+
+template <>
+struct simd_scan_shift<2, 1> {
+  template <typename V>
+  static RAJA_INLINE V apply(V fill, V v)
+  {
+    return __builtin_shufflevector(fill, v, 0, 2);
+  }
+};
+
+//! log-step scan of the lanes of v: the step for S, then for 2 * S
+template <int W, int S, bool Last = (S >= W)>
+struct simd_scan_steps {
+  template <typename Op, typename V>
+  static RAJA_INLINE V apply(Op op, V id, V v)
+  {
+    v = op.apply(simd_scan_shift<W, S>::apply(id, v), v);
+    return simd_scan_steps<W, 2 * S>::apply(op, id, v);
+  }
+};
+
+template <int W, int S>
+struct simd_scan_steps<W, S, true> {
+  template <typename Op, typename V>
+  static RAJA_INLINE V apply(Op, V, V v)
+  {
+    return v;
+  }
+};
+
+/*!
+ * Whether scan_block of Values from Iter to OutIter uses the in-register
+ * scan: the operator must allow it, the values must fill 32 or 64 bit
+ * lanes, and both ranges must be contiguous.
+ */
+template <typename Value, typename Iter, typename OutIter, typename BinFn>
+struct use_simd_scan
+    : std::integral_constant<
+          bool,
+          is_simd_scan_op<BinFn, Value>::value
+              && (sizeof(Value) == 4 || sizeof(Value) == 8)
+              && std::is_pointer<Iter>::value
+              && std::is_pointer<OutIter>::value
+              && std::is_same<typename std::remove_cv<typename std::
+                                  remove_pointer<Iter>::type>::type,
+                              Value>::value
+              && std::is_same<typename std::remove_pointer<OutIter>::type,
+                              Value>::value> {
+};
+
+/*!
+ * In-register scan: each vector of values is scanned by log-step shifts
+ * and combines within the vector, then the running value of the vectors
+ * before it, kept in every lane, is combined into all lanes.
+ */
+template <bool Exclusive,
+          typename Value,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+RAJA_INLINE Value scan_block(Iter in,
+                             OutIter out,
+                             Index_type i0,
+                             Index_type i1,
+                             BinFn f,
+                             Value agg,
+                             std::true_type)
+{
+  using V = typename simd_scan_vector<Value>::type;
+  constexpr int W = simd_scan_vector<Value>::lanes;
+  const simd_scan_op<BinFn> op{};
+  const V id = V{} + BinFn::identity();
+
+  V carry = V{} + agg;
+  Index_type i = i0;
+  for (; i + W <= i1; i += W) {
+    V v;
+    std::memcpy(&v, in + i, sizeof(V));
+    v = simd_scan_steps<W, 1>::apply(op, id, v);
+    const V next = op.apply(carry, V{} + v[W - 1]);
+    if (Exclusive) {
+      v = simd_scan_shift<W, 1>::apply(id, v);
+    }
+    v = op.apply(carry, v);
+    std::memcpy(out + i, &v, sizeof(V));
+    carry = next;
+  }
+  return scan_block<Exclusive>(
+      in, out, i, i1, f, Value(carry[0]), std::false_type{});
+}
+
+#else
+
+template <typename Value, typename Iter, typename OutIter, typename BinFn>
+struct use_simd_scan : std::false_type {
+};
+
+#endif
+
+/*!
+ * Scan [i0, i1) of in into out as above, in registers when the operator,
+ * value type and iterators allow it.
+ */
+template <bool Exclusive,
+          typename Value,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+RAJA_INLINE Value scan_block(Iter in,
+                             OutIter out,
+                             Index_type i0,
+                             Index_type i1,
+                             BinFn f,
+                             Value agg)
+{
+  return scan_block<Exclusive>(
+      in,
+      out,
+      i0,
+      i1,
+      f,
+      agg,
+      std::integral_constant<
+          bool,
+          use_simd_scan<Value, Iter, OutIter, BinFn>::value>{});
+}
+
+/*!
+ * Reduction of a run of values; starts_segment is set if a segment begins
+ * inside the run, in which case value only covers the values from the last
+ * segment start onwards.
+ */
+template <typename T>
+struct SegmentPartial {
+  bool starts_segment;
+  T value;
+};
+
+/*!
+ * Scan operator of SegmentPartials, combining an earlier run a with a later
+ * run b.  Values before a segment start never reach the segment, so a scan
+ * of the partials of consecutive blocks gives each block the running value
+ * of the segment that is open where the block begins.
+ */
+template <typename T, typename Function>
+struct segmented_op {
+  Function op;
+
+  static SegmentPartial<T> identity()
+  {
+    return SegmentPartial<T>{false, Function::identity()};
+  }
+
+  SegmentPartial<T> operator()(SegmentPartial<T> const &a,
+                               SegmentPartial<T> const &b) const
+  {
+    return b.starts_segment
+               ? b
+               : SegmentPartial<T>{a.starts_segment, op(a.value, b.value)};
+  }
+};
+
+/*!
+ * Segment starts given by an array of head flags; a non-zero flags[i]
+ * starts a new segment at i, and first always starts one.
+ *
+ * at(i0) returns a cursor for a block beginning at i0, which is then asked
+ * about increasing positions.
+ */
+template <typename FlagIter>
+struct HeadFlags {
+  FlagIter flags;
+  Index_type first;
+
+  RAJA_INLINE HeadFlags at(Index_type) const { return *this; }
+
+  RAJA_INLINE bool operator()(Index_type i)
+  {
+    return i == first || static_cast<bool>(flags[i]);
+  }
+};
+
+/*!
+ * Segment starts given by nsegs + 1 non-decreasing offsets; segment s
+ * spans [offsets[s], offsets[s + 1]).
+ */
+template <typename OffsetIter>
+struct HeadOffsets {
+  OffsetIter offsets;
+  Index_type nsegs;
+  //! first segment that does not start before the current position
+  Index_type next;
+
+  RAJA_INLINE HeadOffsets at(Index_type i0) const
+  {
+    return HeadOffsets{
+        offsets,
+        nsegs,
+        static_cast<Index_type>(
+            std::lower_bound(offsets, offsets + nsegs, i0) - offsets)};
+  }
+
+  RAJA_INLINE bool operator()(Index_type i)
+  {
+    while (next < nsegs && offsets[next] < i) {
+      ++next;
+    }
+    return next < nsegs && offsets[next] == i;
+  }
+};
+
+/*!
+ * Fold [i0, i1) of in into the partial st.  Every segment starts from init,
+ * which is the identity of f for inclusive scans.
+ */
+template <typename Value, typename Iter, typename Heads, typename BinFn>
+RAJA_INLINE SegmentPartial<Value> segmented_reduce_block(
+    Iter in,
+    Index_type i0,
+    Index_type i1,
+    Heads head,
+    BinFn f,
+    Value const &init,
+    SegmentPartial<Value> st)
+{
+  for (Index_type i = i0; i < i1; ++i) {
+    if (head(i)) {
+      st.starts_segment = true;
+      st.value = f(init, *(in + i));
+    } else {
+      st.value = f(st.value, *(in + i));
+    }
+  }
+  return st;
+}
+
+/*!
+ * Scan [i0, i1) of in into out, continuing from the partial st of the
+ * values before i0, and return the partial including the block.
+ */
+template <bool Exclusive,
+          typename Value,
+          typename Iter,
+          typename OutIter,
+          typename Heads,
+          typename BinFn>
+RAJA_INLINE SegmentPartial<Value> segmented_scan_block(
+    Iter in,
+    OutIter out,
+    Index_type i0,
+    Index_type i1,
+    Heads head,
+    BinFn f,
+    Value const &init,
+    SegmentPartial<Value> st)
+{
+  for (Index_type i = i0; i < i1; ++i) {
+    const Value v = *(in + i);
+    const bool starts = head(i);
+    if (Exclusive) {
+      *(out + i) = starts ? init : st.value;
+    }
+    if (starts) {
+      st.starts_segment = true;
+      st.value = f(init, v);
+    } else {
+      st.value = f(st.value, v);
+    }
+    if (!Exclusive) {
+      *(out + i) = st.value;
+    }
+  }
+  return st;
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_SCAN_HPP */
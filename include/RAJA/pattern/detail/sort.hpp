@@ -0,0 +1,126 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Internal header with the merge steps of the parallel merge sorts
+ *          of the execution backends.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_SORT_HPP
+#define RAJA_PATTERN_DETAIL_SORT_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! inputs shorter than this are sorted by a single thread
+constexpr Index_type sort_serial_threshold = 1 << 14;
+
+//! number of output elements written by each task of a merge
+constexpr Index_type merge_block_size = 1 << 14;
+
+/*!
+ * Number of elements of a that are among the first k elements of the
+ * stable merge of a (length na) and b (length nb); ties go to a.
+ */
+template <typename IterA, typename IterB, typename Compare>
+RAJA_INLINE Index_type merge_rank(IterA a,
+                                  Index_type na,
+                                  IterB b,
+                                  Index_type nb,
+                                  Index_type k,
+                                  Compare comp)
+{
+  Index_type lo = std::max<Index_type>(0, k - nb);
+  Index_type hi = std::min(k, na);
+  while (lo < hi) {
+    const Index_type i = lo + (hi - lo) / 2;
+    if (!comp(*(b + (k - i - 1)), *(a + i))) {
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+/*!
+ * Sorted runs of a merge sort of n elements that starts from nleaves
+ * equal blocks; leaf r spans [leaf_begin(r), leaf_begin(r + 1)).
+ */
+struct MergeRuns {
+  Index_type n;
+  Index_type nleaves;
+
+  RAJA_INLINE Index_type leaf_begin(Index_type r) const
+  {
+    r = std::min(r, nleaves);
+    return (n / nleaves) * r + (n % nleaves) * r / nleaves;
+  }
+};
+
+/*!
+ * One part of a merge pass in which pairs of runs of width leaves are
+ * merged from src into dst: write the merged elements [o0, o1) of every
+ * pair.  The output ranges of the parts of a pass may be handled
+ * concurrently; a trailing run without a partner is copied.
+ */
+template <typename Iter, typename OutIter, typename Compare>
+RAJA_INLINE void merge_pass_part(Iter src,
+                                 OutIter dst,
+                                 MergeRuns runs,
+                                 Index_type width,
+                                 Index_type o0,
+                                 Index_type o1,
+                                 Compare comp)
+{
+  for (Index_type r = 0; r < runs.nleaves; r += 2 * width) {
+    const Index_type s = runs.leaf_begin(r);
+    const Index_type m = runs.leaf_begin(r + width);
+    const Index_type e = runs.leaf_begin(r + 2 * width);
+    const Index_type lo = std::max(o0, s);
+    const Index_type hi = std::min(o1, e);
+    if (lo >= hi) continue;
+
+    Iter a = src + s;
+    Iter b = src + m;
+    const Index_type na = m - s;
+    const Index_type nb = e - m;
+    const Index_type i0 = merge_rank(a, na, b, nb, lo - s, comp);
+    const Index_type i1 = merge_rank(a, na, b, nb, hi - s, comp);
+    const Index_type j0 = lo - s - i0;
+    const Index_type j1 = hi - s - i1;
+    std::merge(std::make_move_iterator(a + i0),
+               std::make_move_iterator(a + i1),
+               std::make_move_iterator(b + j0),
+               std::make_move_iterator(b + j1),
+               dst + lo,
+               comp);
+  }
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_SORT_HPP */
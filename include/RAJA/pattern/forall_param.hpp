@@ -0,0 +1,203 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA forall_param declarations.
+ *
+ *          forall_param runs a forall loop whose body receives, after the
+ *          loop index, a reference to a private accumulator for each of a
+ *          tuple of reduction parameters:
+ *
+ *          \code
+ *
+ *          double sum = 0.0;
+ *          double vmax = -1.0e100;
+ *
+ *          RAJA::forall_param<exec_policy>(
+ *              RAJA::RangeSegment(0, N),
+ *              RAJA::make_tuple(RAJA::reduce_sum(&sum),
+ *                               RAJA::reduce_max(&vmax)),
+ *              [=](RAJA::Index_type i, double& s, double& m) {
+ *                s += a[i];
+ *                m = RAJA_MAX(m, a[i]);
+ *              });
+ *
+ *          \endcode
+ *
+ *          The execution backend owns one set of accumulators per thread
+ *          (or per TBB chunk, or per SIMD lane), each starting at the
+ *          identity of its operator.  When the loop completes they are
+ *          combined with the values the targets held before the loop.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_param_HPP
+#define RAJA_forall_param_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/tuple.hpp"
+
+#include "RAJA/pattern/detail/forall_param.hpp"
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Sum reduction parameter for forall_param
+ */
+template <typename T>
+RAJA_INLINE detail::ForallReduceParam<T, operators::plus> reduce_sum(T* target)
+{
+  return detail::ForallReduceParam<T, operators::plus>{target};
+}
+
+/*!
+ * \brief Min reduction parameter for forall_param
+ */
+template <typename T>
+RAJA_INLINE detail::ForallReduceParam<T, operators::minimum> reduce_min(
+    T* target)
+{
+  return detail::ForallReduceParam<T, operators::minimum>{target};
+}
+
+/*!
+ * \brief Max reduction parameter for forall_param
+ */
+template <typename T>
+RAJA_INLINE detail::ForallReduceParam<T, operators::maximum> reduce_max(
+    T* target)
+{
+  return detail::ForallReduceParam<T, operators::maximum>{target};
+}
+
+/*!
+ * \brief Value and location accumulated by a reduce_minloc parameter
+ */
+template <typename T, typename IndexType = Index_type>
+struct MinLocValue {
+  using data_type = T;
+  using index_type = IndexType;
+
+  T val;
+  IndexType loc;
+
+  RAJA_INLINE void minloc(T const& v, IndexType const& l)
+  {
+    // unconditional stores keep the update free of branches in simd loops
+    const T cur = val;
+    const bool take = v < cur;
+    val = take ? v : cur;
+    loc = take ? l : loc;
+  }
+
+  static constexpr T identity_value() { return operators::limits<T>::max(); }
+  static constexpr bool before(T const& a, T const& b) { return a < b; }
+};
+
+/*!
+ * \brief Value and location accumulated by a reduce_maxloc parameter
+ */
+template <typename T, typename IndexType = Index_type>
+struct MaxLocValue {
+  using data_type = T;
+  using index_type = IndexType;
+
+  T val;
+  IndexType loc;
+
+  RAJA_INLINE void maxloc(T const& v, IndexType const& l)
+  {
+    // unconditional stores keep the update free of branches in simd loops
+    const T cur = val;
+    const bool take = cur < v;
+    val = take ? v : cur;
+    loc = take ? l : loc;
+  }
+
+  static constexpr T identity_value() { return operators::limits<T>::min(); }
+  static constexpr bool before(T const& a, T const& b) { return b < a; }
+};
+
+/*!
+ * \brief Min-loc reduction parameter for forall_param; the loop body
+ *        receives a MinLocValue<T, IndexType>&
+ */
+template <typename T, typename IndexType>
+RAJA_INLINE detail::ForallLocParam<MinLocValue<T, IndexType>> reduce_minloc(
+    T* target,
+    IndexType* target_loc)
+{
+  return detail::ForallLocParam<MinLocValue<T, IndexType>>{target, target_loc};
+}
+
+/*!
+ * \brief Max-loc reduction parameter for forall_param; the loop body
+ *        receives a MaxLocValue<T, IndexType>&
+ */
+template <typename T, typename IndexType>
+RAJA_INLINE detail::ForallLocParam<MaxLocValue<T, IndexType>> reduce_maxloc(
+    T* target,
+    IndexType* target_loc)
+{
+  return detail::ForallLocParam<MaxLocValue<T, IndexType>>{target, target_loc};
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief forall over a container with reduction parameters passed to the
+ *        loop body by reference
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Container,
+          typename... Params,
+          typename LoopBody>
+RAJA_INLINE void forall_param(ExecutionPolicy&& p,
+                              Container&& c,
+                              camp::tuple<Params...> const& params,
+                              LoopBody&& loop_body)
+{
+  using wrapper_t =
+      detail::ForallParamWrapper<camp::tuple<Params...>, camp::decay<LoopBody>>;
+
+  // accumulators used by backends that do not privatize the loop body,
+  // combined into the targets when this goes out of scope
+  typename wrapper_t::privatizer root(params, loop_body);
+
+  forall(std::forward<ExecutionPolicy>(p),
+         std::forward<Container>(c),
+         root.get_priv());
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ *        forall_param
+ */
+template <typename ExecutionPolicy, typename... Args>
+RAJA_INLINE void forall_param(Args&&... args)
+{
+  forall_param(ExecutionPolicy(), std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
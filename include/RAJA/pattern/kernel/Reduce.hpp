@@ -23,6 +23,9 @@
 #include <iostream>
 #include <type_traits>
 
+#include "RAJA/internal/LegacyCompatibility.hpp"
+
+#include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/kernel/internal.hpp"
 
 namespace RAJA
@@ -55,6 +58,278 @@ struct Reduce : public internal::Statement<camp::nil, EnclosedStmts...> {
 }  // end namespace statement
 
 
+namespace internal
+{
+
+
+/*!
+ * Concatenation of camp::list's of statements.
+ */
+template <typename... Lists>
+struct ReduceListJoin {
+  using type = camp::list<>;
+};
+
+template <typename... Stmts>
+struct ReduceListJoin<camp::list<Stmts...>> {
+  using type = camp::list<Stmts...>;
+};
+
+template <typename... Stmts0, typename... Stmts1, typename... Rest>
+struct ReduceListJoin<camp::list<Stmts0...>, camp::list<Stmts1...>, Rest...> {
+  using type =
+      typename ReduceListJoin<camp::list<Stmts0..., Stmts1...>, Rest...>::type;
+};
+
+
+template <typename Stmt, typename... Stmts>
+struct ReduceListContains : std::false_type {
+};
+
+template <typename Stmt, typename First, typename... Stmts>
+struct ReduceListContains<Stmt, First, Stmts...>
+    : std::conditional<std::is_same<Stmt, First>::value,
+                       std::true_type,
+                       ReduceListContains<Stmt, Stmts...>>::type {
+};
+
+
+/*!
+ * Removes repeated statements from a camp::list, keeping the first of each.
+ */
+template <typename Seen, typename... Stmts>
+struct ReduceListUnique;
+
+template <typename... Seen>
+struct ReduceListUnique<camp::list<Seen...>> {
+  using type = camp::list<Seen...>;
+};
+
+template <typename... Seen, typename Stmt, typename... Stmts>
+struct ReduceListUnique<camp::list<Seen...>, Stmt, Stmts...> {
+  using type = typename std::conditional<
+      ReduceListContains<Stmt, Seen...>::value,
+      ReduceListUnique<camp::list<Seen...>, Stmts...>,
+      ReduceListUnique<camp::list<Seen..., Stmt>, Stmts...>>::type::type;
+};
+
+
+/*!
+ * Collects every statement::Reduce using ReducePolicy that is nested
+ * anywhere inside the statement list StmtList.  The enclosed statements of
+ * a Reduce are not searched, since they run after the reduction completes.
+ */
+template <typename ReducePolicy, typename StmtList>
+struct ReduceStatementsInList;
+
+template <typename ReducePolicy, typename Stmt>
+struct ReduceStatementsIn {
+  using type = typename ReduceStatementsInList<
+      ReducePolicy,
+      typename Stmt::enclosed_statements_t>::type;
+};
+
+template <typename ReducePolicy,
+          template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts>
+struct ReduceStatementsIn<
+    ReducePolicy,
+    statement::Reduce<ReducePolicy, ReduceOperator, ParamId, EnclosedStmts...>> {
+  using type = camp::list<
+      statement::Reduce<ReducePolicy, ReduceOperator, ParamId, EnclosedStmts...>>;
+};
+
+template <typename ReducePolicy, typename... Stmts>
+struct ReduceStatementsInList<ReducePolicy, camp::list<Stmts...>> {
+  using type = typename ReduceListJoin<
+      typename ReduceStatementsIn<ReducePolicy, Stmts>::type...>::type;
+};
+
+template <typename StmtList>
+struct ReduceListUniqueOf;
+
+template <typename... Stmts>
+struct ReduceListUniqueOf<camp::list<Stmts...>> {
+  using type = typename ReduceListUnique<camp::list<>, Stmts...>::type;
+};
+
+/*!
+ * The distinct statement::Reduce's using ReducePolicy below StmtList.
+ */
+template <typename ReducePolicy, typename StmtList>
+using enclosed_reduce_statements_t = typename ReduceListUniqueOf<
+    typename ReduceStatementsInList<ReducePolicy, StmtList>::type>::type;
+
+/*!
+ * Per-thread partial result of one statement::Reduce.
+ *
+ * A host executor for a parallel statement pushes an accumulator for each
+ * Reduce it encloses before running a chunk of iterations on a thread, and
+ * the Reduce statement folds the Param into the innermost accumulator pushed
+ * on the calling thread.  Accumulators are looked up by type, so a Reduce
+ * that is reached along several paths shares one partial result.
+ */
+template <typename Data, typename ReduceStmt>
+struct ReduceAccumulator;
+
+template <typename Data,
+          typename ReducePolicy,
+          template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts>
+struct ReduceAccumulator<
+    Data,
+    statement::Reduce<ReducePolicy, ReduceOperator, ParamId, EnclosedStmts...>> {
+
+  using value_type =
+      camp::decay<decltype(std::declval<Data &>().template get_param<ParamId>())>;
+  using combiner_t = RAJA::reduce::detail::op_adapter<value_type, ReduceOperator>;
+
+  value_type value = combiner_t::identity();
+  bool active = false;
+  ReduceAccumulator *previous = nullptr;
+
+  ReduceAccumulator() = default;
+
+  //! start from the value the Param holds before the parallel statement
+  explicit ReduceAccumulator(Data &data)
+      : value(data.template get_param<ParamId>())
+  {
+  }
+
+  static ReduceAccumulator *&current()
+  {
+    static thread_local ReduceAccumulator *acc = nullptr;
+    return acc;
+  }
+
+  int push()
+  {
+    previous = current();
+    current() = this;
+    return 0;
+  }
+
+  int pop()
+  {
+    current() = previous;
+    return 0;
+  }
+
+  //! set a thread-private Param to the identity of the operator
+  int reset(Data &data) const
+  {
+    data.template assign_param<ParamId>(combiner_t::identity());
+    return 0;
+  }
+
+  //! fold the current Param value in and reset it for the next iteration
+  void fold(Data &data)
+  {
+    combiner_t{}(value, data.template get_param<ParamId>());
+    active = true;
+    reset(data);
+  }
+
+  int combine(ReduceAccumulator const &other)
+  {
+    if (other.active) {
+      combiner_t{}(value, other.value);
+      active = true;
+    }
+    return 0;
+  }
+
+  //! hand the reduced value to the enclosed statements, once
+  int finish(Data &data)
+  {
+    if (active) {
+      data.template assign_param<ParamId>(value);
+      execute_statement_list<camp::list<EnclosedStmts...>>(data);
+    }
+    return 0;
+  }
+};
+
+
+/*!
+ * The accumulators of all Reduce statements enclosed by a parallel
+ * statement.
+ */
+template <typename Data, typename ReduceList>
+struct ReduceAccumulatorList;
+
+template <typename Data, typename... ReduceStmts>
+struct ReduceAccumulatorList<Data, camp::list<ReduceStmts...>>
+    : ReduceAccumulator<Data, ReduceStmts>... {
+
+  ReduceAccumulatorList() = default;
+
+  explicit ReduceAccumulatorList(Data &data)
+      : ReduceAccumulator<Data, ReduceStmts>(data)...
+  {
+  }
+
+  void push() { VarOps::ignore_args(ReduceAccumulator<Data, ReduceStmts>::push()...); }
+
+  void pop() { VarOps::ignore_args(ReduceAccumulator<Data, ReduceStmts>::pop()...); }
+
+  void reset(Data &data) const
+  {
+    VarOps::ignore_args(ReduceAccumulator<Data, ReduceStmts>::reset(data)...);
+  }
+
+  void combine(ReduceAccumulatorList const &other)
+  {
+    VarOps::ignore_args(ReduceAccumulator<Data, ReduceStmts>::combine(
+        static_cast<ReduceAccumulator<Data, ReduceStmts> const &>(other))...);
+  }
+
+  //! run the enclosed statements of each Reduce in declaration order
+  void finish(Data &data)
+  {
+    int expand[] = {0, ReduceAccumulator<Data, ReduceStmts>::finish(data)...};
+    (void)expand;
+  }
+};
+
+
+/*!
+ * Executes a statement::Reduce for a host reduction policy.  Inside a
+ * parallel statement the Param is folded into the calling thread's partial
+ * result; anywhere else the Param already holds the reduced value and this
+ * is a passthrough to the enclosed statements.
+ */
+template <typename ReduceStmt>
+struct HostReduceStatementExecutor;
+
+template <typename ReducePolicy,
+          template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts>
+struct HostReduceStatementExecutor<
+    statement::Reduce<ReducePolicy, ReduceOperator, ParamId, EnclosedStmts...>> {
+
+  using reduce_stmt_t =
+      statement::Reduce<ReducePolicy, ReduceOperator, ParamId, EnclosedStmts...>;
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using accumulator_t = ReduceAccumulator<camp::decay<Data>, reduce_stmt_t>;
+    accumulator_t *acc = accumulator_t::current();
+    if (acc) {
+      acc->fold(data);
+    } else {
+      execute_statement_list<camp::list<EnclosedStmts...>>(data);
+    }
+  }
+};
+
+
+}  // namespace internal
+
 }  // end namespace RAJA
 
 
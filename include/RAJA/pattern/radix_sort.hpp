@@ -0,0 +1,325 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA radix sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_radix_sort_HPP
+#define RAJA_radix_sort_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "camp/concepts.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/scan.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Buffers used by sort_pairs, which grow to the largest input they
+ *        have been used for.  Passing the same object to repeated sorts
+ *        avoids allocating them on every call.
+ */
+template <typename Key, typename Value>
+struct RadixSortScratch {
+  std::vector<Key> keys;
+  std::vector<Value> values;
+  std::vector<Index_type> counts;
+};
+
+namespace detail
+{
+
+//! number of elements handled by each task of a radix sort pass
+constexpr Index_type radix_block_size = 1 << 16;
+
+//! bits of the key sorted by each pass
+constexpr int radix_digit_bits = 8;
+
+constexpr int radix_buckets = 1 << radix_digit_bits;
+
+/*!
+ * Maps keys to unsigned integers with the same ordering.  Signed integers
+ * have their sign bit flipped; IEEE floats have all bits flipped when
+ * negative and the sign bit flipped otherwise, so -0.0 sorts before 0.0
+ * and NaNs with the sign bit clear sort after infinity.
+ */
+template <typename Key, typename Enable = void>
+struct radix_key;
+
+template <typename Key>
+struct radix_key<
+    Key,
+    typename std::enable_if<std::is_integral<Key>::value
+                            && std::is_unsigned<Key>::value>::type> {
+  using bits_type = Key;
+  static constexpr int bits = std::numeric_limits<Key>::digits;
+
+  static RAJA_INLINE bits_type to_bits(Key k) { return k; }
+};
+
+template <typename Key>
+struct radix_key<
+    Key,
+    typename std::enable_if<std::is_integral<Key>::value
+                            && std::is_signed<Key>::value>::type> {
+  using bits_type = typename std::make_unsigned<Key>::type;
+  static constexpr int bits = std::numeric_limits<bits_type>::digits;
+
+  static RAJA_INLINE bits_type to_bits(Key k)
+  {
+    return static_cast<bits_type>(k) ^ (bits_type(1) << (bits - 1));
+  }
+};
+
+template <typename Key>
+struct radix_key<
+    Key,
+    typename std::enable_if<std::is_floating_point<Key>::value>::type> {
+  static_assert(std::numeric_limits<Key>::is_iec559
+                    && (sizeof(Key) == 4 || sizeof(Key) == 8),
+                "sort_pairs supports IEEE float and double keys");
+
+  using bits_type = typename std::
+      conditional<sizeof(Key) == 4, std::uint32_t, std::uint64_t>::type;
+  static constexpr int bits = std::numeric_limits<bits_type>::digits;
+
+  static RAJA_INLINE bits_type to_bits(Key k)
+  {
+    bits_type b;
+    std::memcpy(&b, &k, sizeof(Key));
+    const bits_type sign = bits_type(1) << (bits - 1);
+    return (b & sign) ? ~b : (b | sign);
+  }
+};
+
+template <typename Traits>
+RAJA_INLINE int radix_digit(typename Traits::bits_type b, int shift, int mask)
+{
+  return static_cast<int>(b >> shift) & mask;
+}
+
+/*!
+ * One stable counting-sort pass on the digit of the keys at shift.  Every
+ * block of the input counts its digits; the counts are stored digit-major,
+ * so one exclusive scan gives each block the first output position of each
+ * digit, and each block then scatters its elements in order.
+ *
+ * Returns false, without moving anything, when all keys share the digit.
+ */
+template <typename ExecPolicy,
+          typename Traits,
+          typename KeyIn,
+          typename ValueIn,
+          typename KeyOut,
+          typename ValueOut>
+bool radix_pass(const ExecPolicy &p,
+                Traits,
+                KeyIn kin,
+                ValueIn vin,
+                KeyOut kout,
+                ValueOut vout,
+                Index_type n,
+                int shift,
+                int mask,
+                Index_type *counts)
+{
+  const Index_type nblocks = (n + radix_block_size - 1) / radix_block_size;
+
+  forall(p, RangeSegment(0, nblocks), [=](Index_type b) {
+    Index_type local[radix_buckets] = {};
+    const Index_type i1 = std::min(n, (b + 1) * radix_block_size);
+    for (Index_type i = b * radix_block_size; i < i1; ++i) {
+      ++local[radix_digit<Traits>(Traits::to_bits(*(kin + i)), shift, mask)];
+    }
+    for (int d = 0; d <= mask; ++d) {
+      counts[d * nblocks + b] = local[d];
+    }
+  });
+
+  const Index_type ncounts = (mask + 1) * nblocks;
+  counts[ncounts] = 0;
+  impl::scan::exclusive_inplace(seq_exec{},
+                                counts,
+                                counts + ncounts + 1,
+                                operators::plus<Index_type>{},
+                                Index_type{0});
+  for (int d = 0; d <= mask; ++d) {
+    if (counts[(d + 1) * nblocks] - counts[d * nblocks] == n) return false;
+  }
+
+  forall(p, RangeSegment(0, nblocks), [=](Index_type b) {
+    Index_type offset[radix_buckets];
+    for (int d = 0; d <= mask; ++d) {
+      offset[d] = counts[d * nblocks + b];
+    }
+    const Index_type i1 = std::min(n, (b + 1) * radix_block_size);
+    for (Index_type i = b * radix_block_size; i < i1; ++i) {
+      const int d =
+          radix_digit<Traits>(Traits::to_bits(*(kin + i)), shift, mask);
+      const Index_type o = offset[d]++;
+      *(kout + o) = *(kin + i);
+      *(vout + o) = std::move(*(vin + i));
+    }
+  });
+  return true;
+}
+
+template <typename ExecPolicy, typename KeyIter, typename ValueIter>
+void radix_sort_pairs(
+    const ExecPolicy &p,
+    KeyIter keys,
+    ValueIter values,
+    Index_type n,
+    RadixSortScratch<IterVal<KeyIter>, IterVal<ValueIter>> &scratch,
+    int begin_bit,
+    int end_bit)
+{
+  using Key = IterVal<KeyIter>;
+  using Value = IterVal<ValueIter>;
+  using Traits = radix_key<Key>;
+
+  end_bit = std::min(end_bit, Traits::bits);
+  if (n <= 1 || begin_bit >= end_bit) return;
+
+  const Index_type nblocks = (n + radix_block_size - 1) / radix_block_size;
+  if (scratch.keys.size() < static_cast<size_t>(n)) {
+    scratch.keys.resize(n);
+    scratch.values.resize(n);
+  }
+  const Index_type ncounts = radix_buckets * nblocks + 1;
+  if (scratch.counts.size() < static_cast<size_t>(ncounts)) {
+    scratch.counts.resize(ncounts);
+  }
+  Key *const kbuf = scratch.keys.data();
+  Value *const vbuf = scratch.values.data();
+  Index_type *const counts = scratch.counts.data();
+
+  bool in_buffer = false;
+  for (int shift = begin_bit; shift < end_bit; shift += radix_digit_bits) {
+    const int width = std::min(radix_digit_bits, end_bit - shift);
+    const int mask = (1 << width) - 1;
+    bool moved;
+    if (in_buffer) {
+      moved = radix_pass(
+          p, Traits{}, kbuf, vbuf, keys, values, n, shift, mask, counts);
+    } else {
+      moved = radix_pass(
+          p, Traits{}, keys, values, kbuf, vbuf, n, shift, mask, counts);
+    }
+    if (moved) {
+      in_buffer = !in_buffer;
+    }
+  }
+
+  if (in_buffer) {
+    forall(p, RangeSegment(0, n), [=](Index_type i) {
+      *(keys + i) = kbuf[i];
+      *(values + i) = std::move(vbuf[i]);
+    });
+  }
+}
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  key-value radix sort execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] keys Pointer or Random-Access Iterator to the keys
+* \param[in,out] values Pointer or Random-Access Iterator to the values
+* \param[in] n number of keys and values
+* \param[in] begin_bit first bit of the keys to sort on
+* \param[in] end_bit one past the last bit of the keys to sort on
+*
+* Sorts the keys in ascending order and applies the same permutation to the
+* values; the sort is stable.  Keys may be integers or IEEE floats.  Bits
+* are numbered in the order-preserving unsigned image of the keys, which
+* for unsigned keys is the key itself; skipping bits that are known to be
+* equal in all keys skips the passes over them.
+*
+* The sort makes one pass per 8 bits of the bit range.  Its buffers are
+* allocated for each call and freed on return; the overload taking a
+* RadixSortScratch reuses the caller's buffers instead.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValueIter>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<ValueIter>>
+sort_pairs(const ExecPolicy &p,
+           KeyIter keys,
+           ValueIter values,
+           Index_type n,
+           int begin_bit = 0,
+           int end_bit = detail::radix_key<detail::IterVal<KeyIter>>::bits)
+{
+  using Scratch = RadixSortScratch<detail::IterVal<KeyIter>,
+                                   detail::IterVal<ValueIter>>;
+  Scratch scratch;
+  detail::radix_sort_pairs(p, keys, values, n, scratch, begin_bit, end_bit);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  key-value radix sort execution pattern using caller-provided
+*         buffers
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValueIter>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<KeyIter>,
+                    type_traits::is_iterator<ValueIter>>
+sort_pairs(const ExecPolicy &p,
+           KeyIter keys,
+           ValueIter values,
+           Index_type n,
+           RadixSortScratch<detail::IterVal<KeyIter>,
+                            detail::IterVal<ValueIter>> &scratch,
+           int begin_bit = 0,
+           int end_bit = detail::radix_key<detail::IterVal<KeyIter>>::bits)
+{
+  detail::radix_sort_pairs(p, keys, values, n, scratch, begin_bit, end_bit);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>> sort_pairs(
+    Args &&... args)
+{
+  RAJA::sort_pairs(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
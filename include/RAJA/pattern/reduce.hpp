@@ -156,6 +156,69 @@ class ReduceMax;
 template <typename REDUCE_POLICY_T, typename T, typename IndexType = Index_type>
 class ReduceMaxLoc;
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reducer class template keeping the K smallest values and their
+ *         locations.
+ *
+ * Each thread keeps its own sorted list of at most K candidates; the lists
+ * are merged by get(), which returns the K best entries in ascending order.
+ * Equal values are ordered by location.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Real_ptr data = ...;
+   ReduceMinK<reduce_policy, Real_type, Index_type, 4> my_mins;
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_mins.minloc(data[i], i);
+   }
+
+   auto mins = my_mins.get();
+   for (size_t j = 0; j < mins.size(); ++j) {
+      Real_type val = mins.value(j);
+      Index_type loc = mins.getLoc(j);
+   }
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T, typename IndexType, size_t K>
+class ReduceMinK;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reducer class template keeping the K largest values and their
+ *         locations.
+ *
+ * As ReduceMinK, with get() returning the K largest entries in descending
+ * order.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Real_ptr data = ...;
+   ReduceMaxK<reduce_policy, Real_type, Index_type, 4> my_maxs;
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_maxs.maxloc(data[i], i);
+   }
+
+   auto maxs = my_maxs.get();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T, typename IndexType, size_t K>
+class ReduceMaxK;
+
 /*!
  ******************************************************************************
  *
@@ -180,6 +243,159 @@ class ReduceMaxLoc;
  */
 template <typename REDUCE_POLICY_T, typename T>
 class ReduceSum;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Product reducer class template.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Real_ptr data = ...;
+   ReduceProd<reduce_policy, Real_type> my_prod(init_val);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_prod *= data[i];
+   }
+
+   Real_type prod = my_prod.get();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class ReduceProd;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Bitwise-or reducer class template.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Int_ptr flags = ...;
+   ReduceBitOr<reduce_policy, int> my_flags(0);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_flags |= flags[i];
+   }
+
+   int any_flags = my_flags.get();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class ReduceBitOr;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Bitwise-and reducer class template.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Int_ptr flags = ...;
+   ReduceBitAnd<reduce_policy, int> my_flags(~0);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_flags &= flags[i];
+   }
+
+   int all_flags = my_flags.get();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class ReduceBitAnd;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Logical-or reducer class template.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Real_ptr data = ...;
+   ReduceLogicalOr<reduce_policy, bool> any_negative(false);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      any_negative.logical_or(data[i] < 0.0);
+   }
+
+   bool found = any_negative.get();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class ReduceLogicalOr;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Logical-and reducer class template.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Real_ptr data = ...;
+   ReduceLogicalAnd<reduce_policy, bool> all_positive(true);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      all_positive.logical_and(data[i] > 0.0);
+   }
+
+   bool ok = all_positive.get();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class ReduceLogicalAnd;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reducer class template for a user-chosen operator.
+ *
+ * Op may be any fully specified RAJA::operators functor (or user functor)
+ * that is associative and provides a static identity() method.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Int_ptr data = ...;
+   Reduce<reduce_policy, int, operators::bit_xor<int>> my_xor(0);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_xor.reduce(data[i]);
+   }
+
+   int parity = my_xor.get();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T, typename Op>
+class Reduce;
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,453 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA segmented, by-key and transform
+*          reduction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_reduce_segmented_HPP
+#define RAJA_reduce_segmented_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "camp/concepts.hpp"
+#include "camp/helpers.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/internal/Iterators.hpp"
+#include "RAJA/pattern/detail/scan.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/scan.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! number of values reduced by each task of a segmented reduction
+constexpr Index_type segmented_chunk_size = 4096;
+
+/*!
+ * What one chunk of values leaves to be combined with its neighbours: the
+ * values of the segment that was begun by an earlier chunk and ends in this
+ * one (head, for segment head_segment, or -1 if there is none), and the
+ * partial of the segment still open at the end of the chunk (tail).
+ */
+template <typename T>
+struct SegmentChunk {
+  SegmentPartial<T> tail;
+  T head;
+  Index_type head_segment;
+};
+
+template <typename T, typename Iter, typename Function>
+RAJA_INLINE T reduce_range(Iter values,
+                           Index_type begin,
+                           Index_type end,
+                           Function const &op)
+{
+  T value = Function::identity();
+  for (Index_type i = begin; i < end; ++i) {
+    value = op(value, values[i]);
+  }
+  return value;
+}
+
+/*!
+ * The values are cut into chunks of equal length independent of the
+ * segment boundaries, so a long segment is reduced by several tasks.  Each
+ * task writes the segments lying entirely in its chunk, the partials of
+ * the segments crossing the chunk boundaries are combined with a scan, and
+ * a last pass writes the segments that crossed a boundary.
+ */
+template <typename ExecPolicy,
+          typename Iter,
+          typename OffsetIter,
+          typename IterOut,
+          typename Function>
+void reduce_segmented(const ExecPolicy &p,
+                      Iter values,
+                      OffsetIter offsets,
+                      Index_type nsegs,
+                      IterOut out,
+                      Function op)
+{
+  using T = IterVal<IterOut>;
+  using chunk_type = SegmentChunk<T>;
+  using partial_type = SegmentPartial<T>;
+
+  if (nsegs <= 0) return;
+
+  const Index_type first = offsets[0];
+  const Index_type last = offsets[nsegs];
+  const Index_type nchunks = std::max(
+      Index_type(1),
+      (last - first + segmented_chunk_size - 1) / segmented_chunk_size);
+
+  std::vector<chunk_type> chunks(nchunks);
+  chunk_type *chunk_data = chunks.data();
+
+  forall(p, RangeSegment(0, nchunks), [=](Index_type c) {
+    const Index_type c0 = first + c * segmented_chunk_size;
+    const Index_type c1 = std::min(last, c0 + segmented_chunk_size);
+
+    // this chunk writes the segments starting in [c0, c1), and the last
+    // chunk also the empty segments at the very end
+    Index_type s = std::lower_bound(offsets, offsets + nsegs, c0) - offsets;
+    const Index_type s_end =
+        (c == nchunks - 1)
+            ? nsegs
+            : std::lower_bound(offsets + s, offsets + nsegs, c1) - offsets;
+
+    chunk_type &chunk = chunk_data[c];
+    chunk.tail = partial_type{true, Function::identity()};
+    chunk.head = Function::identity();
+    chunk.head_segment = -1;
+
+    // segment s - 1 began before this chunk and still holds c0
+    if (c0 < c1 && (s == nsegs || offsets[s] > c0)) {
+      const Index_type end = offsets[s];
+      const T head =
+          reduce_range<T>(values, c0, std::min<Index_type>(end, c1), op);
+      if (end <= c1) {
+        chunk.head = head;
+        chunk.head_segment = s - 1;
+      } else {
+        chunk.tail = partial_type{false, head};
+      }
+    }
+
+    for (; s < s_end; ++s) {
+      const Index_type begin = offsets[s];
+      const Index_type end = offsets[s + 1];
+      if (end <= c1) {
+        out[s] = reduce_range<T>(values, begin, end, op);
+      } else {
+        chunk.tail =
+            partial_type{true, reduce_range<T>(values, begin, c1, op)};
+      }
+    }
+  });
+
+  // there are few chunks, so their partials are scanned sequentially
+  std::vector<partial_type> carry(nchunks);
+  for (Index_type c = 0; c < nchunks; ++c) {
+    carry[c] = chunks[c].tail;
+  }
+  impl::scan::exclusive_inplace(seq_exec{},
+                                carry.data(),
+                                carry.data() + nchunks,
+                                segmented_op<T, Function>{op},
+                                segmented_op<T, Function>::identity());
+
+  const partial_type *carry_data = carry.data();
+  forall(p, RangeSegment(0, nchunks), [=](Index_type c) {
+    const chunk_type &chunk = chunk_data[c];
+    if (chunk.head_segment >= 0) {
+      out[chunk.head_segment] = op(carry_data[c].value, chunk.head);
+    }
+  });
+}
+
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename Iter,
+          typename KeyOut,
+          typename IterOut,
+          typename Function>
+Index_type reduce_by_key(const ExecPolicy &p,
+                         KeyIter keys,
+                         Index_type n,
+                         Iter values,
+                         KeyOut out_keys,
+                         IterOut out_values,
+                         Function op)
+{
+  if (n <= 0) return 0;
+
+  // number each run of equal keys with a scan of the run heads
+  std::vector<Index_type> run(n);
+  Index_type *run_data = run.data();
+  forall(p, RangeSegment(0, n), [=](Index_type i) {
+    run_data[i] = (i == 0 || !(keys[i] == keys[i - 1])) ? 1 : 0;
+  });
+  const Index_type last_head = run[n - 1];
+  impl::scan::exclusive_inplace(
+      p, run_data, run_data + n, operators::plus<Index_type>{}, Index_type(0));
+  const Index_type nruns = run[n - 1] + last_head;
+
+  std::vector<Index_type> offsets(nruns + 1);
+  Index_type *offset_data = offsets.data();
+  forall(p, RangeSegment(0, n), [=](Index_type i) {
+    if (i == 0 || !(keys[i] == keys[i - 1])) {
+      offset_data[run_data[i]] = i;
+      out_keys[run_data[i]] = keys[i];
+    }
+  });
+  offsets[nruns] = n;
+
+  detail::reduce_segmented(p, values, offset_data, nruns, out_values, op);
+  return nruns;
+}
+
+}  // end namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  segmented reduction execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] values Pointer or Random-Access Iterator to the values
+* \param[in] offsets Pointer or Random-Access Iterator to nsegs + 1
+*non-decreasing offsets; segment s is [values + offsets[s], values +
+*offsets[s + 1])
+* \param[in] nsegs number of segments
+* \param[out] out Pointer or Random-Access Iterator receiving the reduction
+*of each segment; empty segments receive the identity of binop
+* \param[in] binop associative binary function with a static identity()
+*
+* Long segments are split between tasks, so the work is balanced however
+* the values are distributed among the segments.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OffsetIter,
+          typename IterOut,
+          typename Function = operators::plus<detail::IterVal<IterOut>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<OffsetIter>,
+                    type_traits::is_iterator<IterOut>>
+reduce_segmented(const ExecPolicy &p,
+                 Iter values,
+                 OffsetIter offsets,
+                 Index_type nsegs,
+                 IterOut out,
+                 Function binop = Function{})
+{
+  using R = detail::IterVal<IterOut>;
+  using T = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, R, T>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OffsetIter>::value,
+                "Offset Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  detail::reduce_segmented(p, values, offsets, nsegs, out, binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  reduce-by-key execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] keys_begin Pointer or Random-Access Iterator to start of keys
+* \param[in] keys_end Pointer or Random-Access Iterator to end of keys
+* \param[in] values Pointer or Random-Access Iterator to the value of each key
+* \param[out] out_keys receives the first key of each run of equal keys
+* \param[out] out_values receives the reduction of the values of each run
+* \param[in] binop associative binary function with a static identity()
+*
+* \return the number of runs of equal keys written to out_keys and
+*out_values
+*
+* \note{Equal keys must be adjacent, e.g. the keys are sorted}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename Iter,
+          typename KeyOut,
+          typename IterOut,
+          typename Function = operators::plus<detail::IterVal<IterOut>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<KeyIter>::value,
+                        Index_type>::type
+reduce_by_key(const ExecPolicy &p,
+              KeyIter keys_begin,
+              KeyIter keys_end,
+              Iter values,
+              KeyOut out_keys,
+              IterOut out_values,
+              Function binop = Function{})
+{
+  using R = detail::IterVal<IterOut>;
+  using T = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, R, T>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<KeyIter>::value,
+                "Key Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<KeyOut>::value,
+                "Key Output Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  return detail::reduce_by_key(p,
+                               keys_begin,
+                               keys_end - keys_begin,
+                               values,
+                               out_keys,
+                               out_values,
+                               binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  reduce-by-key execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] keys Random-Access Range of keys
+* \param[in] values Pointer or Random-Access Iterator to the value of each key
+* \param[out] out_keys receives the first key of each run of equal keys
+* \param[out] out_values receives the reduction of the values of each run
+* \param[in] binop associative binary function with a static identity()
+*
+* \return the number of runs of equal keys
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename Iter,
+          typename KeyOut,
+          typename IterOut,
+          typename Function = operators::plus<detail::IterVal<IterOut>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        Index_type>::type
+reduce_by_key(const ExecPolicy &p,
+              Container &keys,
+              Iter values,
+              KeyOut out_keys,
+              IterOut out_values,
+              Function binop = Function{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return reduce_by_key(p,
+                       std::begin(keys),
+                       std::end(keys),
+                       values,
+                       out_keys,
+                       out_values,
+                       binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  transform-reduce execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] unop unary function applied to each input value
+* \param[in] binop associative binary function with a static identity()
+* \param[in] init value the reduction starts from
+*
+* \return init combined with unop(*i) for every i in [begin, end)
+*
+* The transformed values are never stored.  Each task reduces a fixed-size
+*chunk of the range and the chunk results are combined in order, so the
+*result does not depend on the number of threads and binop need not be
+*commutative.
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename UnaryOp,
+          typename T = detail::TransformVal<Iter, UnaryOp>,
+          typename Function = operators::plus<T>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value,
+                        T>::type
+transform_reduce(const ExecPolicy &p,
+                 Iter begin,
+                 Iter end,
+                 UnaryOp unop,
+                 Function binop = Function{},
+                 T init = Function::identity())
+{
+  using U = detail::TransformVal<Iter, UnaryOp>;
+  static_assert(type_traits::is_binary_function<Function, T, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+
+  const Index_type n = end - begin;
+  const Index_type nchunks =
+      (n + detail::segmented_chunk_size - 1) / detail::segmented_chunk_size;
+  const auto values = Iterators::make_transform_iterator(begin, unop);
+
+  std::vector<T> partials(nchunks);
+  T *partial = partials.data();
+  forall(p, RangeSegment(0, nchunks), [=](Index_type c) {
+    const Index_type c0 = c * detail::segmented_chunk_size;
+    const Index_type c1 = std::min(n, c0 + detail::segmented_chunk_size);
+    partial[c] = detail::reduce_range<T>(values, c0, c1, binop);
+  });
+
+  T result = init;
+  for (Index_type c = 0; c < nchunks; ++c) {
+    result = binop(result, partial[c]);
+  }
+  return result;
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+reduce_segmented(Args &&... args)
+{
+  reduce_segmented(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value,
+                        Index_type>::type
+reduce_by_key(Args &&... args)
+{
+  return reduce_by_key(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto transform_reduce(Args &&... args) -> typename std::enable_if<
+    type_traits::is_execution_policy<ExecPolicy>::value,
+    decltype(RAJA::transform_reduce(ExecPolicy{},
+                                    std::forward<Args>(args)...))>::type
+{
+  return RAJA::transform_reduce(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
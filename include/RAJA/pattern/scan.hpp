@@ -26,8 +26,11 @@
 #include "camp/concepts.hpp"
 #include "camp/helpers.hpp"
 
+#include "RAJA/internal/Iterators.hpp"
+#include "RAJA/pattern/detail/scan.hpp"
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
 
 namespace RAJA
 {
@@ -42,6 +45,10 @@ template <typename Container>
 using ContainerVal =
     camp::decay<decltype(*camp::val<camp::iterator_from<Container>>())>;
 
+template <typename Iter, typename UnaryOp>
+using TransformVal =
+    typename Iterators::transform_iterator<Iter, UnaryOp>::value_type;
+
 }  // end namespace detail
 
 /*!
@@ -342,6 +349,400 @@ exclusive_scan(const ExecPolicy &p,
   impl::scan::exclusive(p, std::begin(c), std::end(c), out, binop, value);
 }
 
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive segmented scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] flags Pointer or Random-Access Iterator to head flags; a
+*non-zero flags[i] restarts the scan at element i
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+*
+* \note{The range of [begin, end) may be the same as [out, out + (end -
+*begin)) but must not partially overlap it}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename FlagIter,
+          typename IterOut,
+          typename Function = operators::plus<detail::IterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<FlagIter>,
+                    type_traits::is_iterator<IterOut>>
+inclusive_segmented_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         FlagIter flags,
+                         IterOut out,
+                         Function binop = Function{})
+{
+  using R = detail::IterVal<IterOut>;
+  using T = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, R, T>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<FlagIter>::value,
+                "Flag Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  impl::scan::inclusive_segmented(p,
+                                  begin,
+                                  0,
+                                  end - begin,
+                                  detail::HeadFlags<FlagIter>{flags, 0},
+                                  out,
+                                  binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive segmented scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] flags Pointer or Random-Access Iterator to head flags; a
+*non-zero flags[i] restarts the scan at element i
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] binop binary function to apply for scan
+* \param[in] value initial value of each segment
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename FlagIter,
+          typename IterOut,
+          typename T = detail::IterVal<Iter>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<FlagIter>,
+                    type_traits::is_iterator<IterOut>>
+exclusive_segmented_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         FlagIter flags,
+                         IterOut out,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using R = detail::IterVal<IterOut>;
+  using U = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<FlagIter>::value,
+                "Flag Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  impl::scan::exclusive_segmented(p,
+                                  begin,
+                                  0,
+                                  end - begin,
+                                  detail::HeadFlags<FlagIter>{flags, 0},
+                                  out,
+                                  binop,
+                                  value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive segmented scan execution pattern over segments given by
+*offsets
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to the values
+* \param[in] offsets Pointer or Random-Access Iterator to nsegs + 1
+*non-decreasing offsets; segment s is [begin + offsets[s], begin +
+*offsets[s + 1])
+* \param[in] nsegs number of segments
+* \param[out] out Pointer or Random-Access Iterator receiving the scan of
+*begin[i] in out[i]
+* \param[in] binop binary function to apply for scan
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OffsetIter,
+          typename IterOut,
+          typename Function = operators::plus<detail::IterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<OffsetIter>,
+                    type_traits::is_iterator<IterOut>>
+inclusive_segmented_scan(const ExecPolicy &p,
+                         Iter begin,
+                         OffsetIter offsets,
+                         Index_type nsegs,
+                         IterOut out,
+                         Function binop = Function{})
+{
+  using R = detail::IterVal<IterOut>;
+  using T = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, R, T>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OffsetIter>::value,
+                "Offset Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (nsegs <= 0) return;
+  impl::scan::inclusive_segmented(
+      p,
+      begin,
+      offsets[0],
+      offsets[nsegs],
+      detail::HeadOffsets<OffsetIter>{offsets, nsegs, 0},
+      out,
+      binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive segmented scan execution pattern over segments given by
+*offsets
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to the values
+* \param[in] offsets Pointer or Random-Access Iterator to nsegs + 1
+*non-decreasing offsets; segment s is [begin + offsets[s], begin +
+*offsets[s + 1])
+* \param[in] nsegs number of segments
+* \param[out] out Pointer or Random-Access Iterator receiving the scan of
+*begin[i] in out[i]
+* \param[in] binop binary function to apply for scan
+* \param[in] value initial value of each segment
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OffsetIter,
+          typename IterOut,
+          typename T = detail::IterVal<Iter>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<OffsetIter>,
+                    type_traits::is_iterator<IterOut>>
+exclusive_segmented_scan(const ExecPolicy &p,
+                         Iter begin,
+                         OffsetIter offsets,
+                         Index_type nsegs,
+                         IterOut out,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using R = detail::IterVal<IterOut>;
+  using U = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<OffsetIter>::value,
+                "Offset Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (nsegs <= 0) return;
+  impl::scan::exclusive_segmented(
+      p,
+      begin,
+      offsets[0],
+      offsets[nsegs],
+      detail::HeadOffsets<OffsetIter>{offsets, nsegs, 0},
+      out,
+      binop,
+      value);
+}
+
+// =============================================================================
+
+namespace impl
+{
+namespace scan
+{
+
+/*!
+ * Back-ends whose scans read each input value once scan transform
+ * iterators; the OpenMP and TBB back-ends provide their own.
+ */
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename UnaryOp,
+          typename BinFn>
+concepts::enable_if<concepts::negate<type_traits::is_openmp_policy<Policy>>,
+                    concepts::negate<type_traits::is_tbb_policy<Policy>>>
+transform_inclusive(const Policy &p,
+                    Iter begin,
+                    Iter end,
+                    OutIter out,
+                    UnaryOp unop,
+                    BinFn f)
+{
+  inclusive(p,
+            Iterators::make_transform_iterator(begin, unop),
+            Iterators::make_transform_iterator(end, unop),
+            out,
+            f);
+}
+
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename UnaryOp,
+          typename BinFn,
+          typename ValueT>
+concepts::enable_if<concepts::negate<type_traits::is_openmp_policy<Policy>>,
+                    concepts::negate<type_traits::is_tbb_policy<Policy>>>
+transform_exclusive(const Policy &p,
+                    Iter begin,
+                    Iter end,
+                    OutIter out,
+                    UnaryOp unop,
+                    BinFn f,
+                    ValueT v)
+{
+  exclusive(p,
+            Iterators::make_transform_iterator(begin, unop),
+            Iterators::make_transform_iterator(end, unop),
+            out,
+            f,
+            v);
+}
+
+}  // namespace scan
+}  // namespace impl
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive transform scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] unop unary function applied to each input value
+* \param[in] binop binary function to apply for scan
+*
+* Scans unop(*i) for the i in [begin, end) without storing the transformed
+*values.  The host back-ends call unop at most once per element; others
+*may call it more than once, so it should not have side effects.
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename UnaryOp,
+          typename Function =
+              operators::plus<detail::TransformVal<Iter, UnaryOp>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<IterOut>>
+transform_inclusive_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         IterOut out,
+                         UnaryOp unop,
+                         Function binop = Function{})
+{
+  using R = detail::IterVal<IterOut>;
+  using T = detail::TransformVal<Iter, UnaryOp>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) return;
+  impl::scan::transform_inclusive(p, begin, end, out, unop, binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive transform scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] unop unary function applied to each input value
+* \param[in] binop binary function to apply for scan
+* \param[in] value identity value for binary function, binop
+*
+* The host back-ends call unop at most once per element; others may call
+*it more than once, so it should not have side effects.  For example, the
+*offsets of variable-length lists are written straight from their sizes:
+*
+* \code
+*
+* RAJA::transform_exclusive_scan<exec_policy>(
+*     zones, zones + N, offsets, [=](int z) { return nnodes(z); });
+*
+* \endcode
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename UnaryOp,
+          typename T = detail::TransformVal<Iter, UnaryOp>,
+          typename Function = operators::plus<T>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>,
+                    type_traits::is_iterator<IterOut>>
+transform_exclusive_scan(const ExecPolicy &p,
+                         Iter begin,
+                         Iter end,
+                         IterOut out,
+                         UnaryOp unop,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using R = detail::IterVal<IterOut>;
+  using U = detail::TransformVal<Iter, UnaryOp>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (begin == end) return;
+  impl::scan::transform_exclusive(p, begin, end, out, unop, binop, value);
+}
+
 template <typename ExecPolicy, typename... Args>
 concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
 exclusive_scan(Args &&... args)
@@ -370,6 +771,34 @@ inclusive_scan_inplace(Args &&... args)
   inclusive_scan_inplace(ExecPolicy{}, std::forward<Args>(args)...);
 }
 
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+inclusive_segmented_scan(Args &&... args)
+{
+  inclusive_segmented_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+exclusive_segmented_scan(Args &&... args)
+{
+  exclusive_segmented_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+transform_inclusive_scan(Args &&... args)
+{
+  transform_inclusive_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+transform_exclusive_scan(Args &&... args)
+{
+  transform_exclusive_scan(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
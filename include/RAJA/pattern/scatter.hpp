@@ -0,0 +1,319 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scatter-add declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scatter_HPP
+#define RAJA_scatter_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "camp/concepts.hpp"
+
+#include "RAJA/pattern/atomic.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/policy/simd/policy.hpp"
+#include "RAJA/util/types.hpp"
+
+/*!
+ * Defined when the target has the AVX-512 conflict detection instructions,
+ * e.g. built with -mavx512cd or -march=native on a processor that has them.
+ * Otherwise simd_exec scatter-adds update the target one lane at a time.
+ */
+#if defined(__AVX512F__) && defined(__AVX512CD__)
+#define RAJA_HAVE_AVX512_CONFLICT
+#include <immintrin.h>
+#endif
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! number of iterations whose bins and values a simd_exec scatter-add
+//! computes together
+constexpr camp::idx_t scatter_lanes = 8;
+
+template <typename ExecPolicy>
+struct is_serial_scatter_policy
+    : std::integral_constant<
+          bool,
+          (type_traits::is_sequential_policy<ExecPolicy>::value
+           || type_traits::is_loop_policy<ExecPolicy>::value)
+              && !type_traits::is_simd_exec<ExecPolicy>::value> {
+};
+
+/*!
+ * Eight lanes of T in an AVX-512 register, for the T whose lanes are
+ * combined in registers: double and 64-bit integers.
+ */
+template <typename T, typename Enable = void>
+struct ScatterVector {
+  static constexpr bool available = false;
+};
+
+#if defined(RAJA_HAVE_AVX512_CONFLICT)
+
+template <>
+struct ScatterVector<double> {
+  static constexpr bool available = true;
+  using type = __m512d;
+
+  static RAJA_INLINE type load(double const *values)
+  {
+    return _mm512_load_pd(values);
+  }
+
+  static RAJA_INLINE type add(type a, __mmask8 lanes, type b)
+  {
+    return _mm512_mask_add_pd(a, lanes, a, b);
+  }
+
+  static RAJA_INLINE type permute(__m512i from, type a)
+  {
+    return _mm512_maskz_permutexvar_pd(0xFF, from, a);
+  }
+
+  static RAJA_INLINE void update(double *target,
+                                 __mmask8 lanes,
+                                 __m512i bins,
+                                 type a)
+  {
+    const type old =
+        _mm512_mask_i64gather_pd(_mm512_setzero_pd(), lanes, bins, target, 8);
+    _mm512_mask_i64scatter_pd(target, lanes, bins, _mm512_add_pd(old, a), 8);
+  }
+};
+
+template <typename T>
+struct ScatterVector<T,
+                     typename std::enable_if<std::is_integral<T>::value
+                                             && sizeof(T) == 8>::type> {
+  static constexpr bool available = true;
+  using type = __m512i;
+
+  static RAJA_INLINE type load(T const *values)
+  {
+    return _mm512_load_si512(values);
+  }
+
+  static RAJA_INLINE type add(type a, __mmask8 lanes, type b)
+  {
+    return _mm512_mask_add_epi64(a, lanes, a, b);
+  }
+
+  static RAJA_INLINE type permute(__m512i from, type a)
+  {
+    return _mm512_maskz_permutexvar_epi64(0xFF, from, a);
+  }
+
+  static RAJA_INLINE void update(T *target,
+                                 __mmask8 lanes,
+                                 __m512i bins,
+                                 type a)
+  {
+    const type old = _mm512_mask_i64gather_epi64(
+        _mm512_setzero_si512(), lanes, bins, target, 8);
+    _mm512_mask_i64scatter_epi64(
+        target, lanes, bins, _mm512_add_epi64(old, a), 8);
+  }
+};
+
+/*!
+ * The lanes that are not the last lane of their bin: those whose bit is set
+ * in the conflicts of any lane.  The zero-masked forms avoid the undefined
+ * pass-through lanes of the unmasked intrinsics, which some GCC versions
+ * warn about.
+ */
+RAJA_INLINE __mmask8 scatter_repeated_later(__m512i conflicts)
+{
+  __m512i a = conflicts;
+  a = _mm512_or_si512(a, _mm512_maskz_alignr_epi64(0xFF, a, a, 4));
+  a = _mm512_or_si512(a, _mm512_maskz_alignr_epi64(0xFF, a, a, 2));
+  a = _mm512_or_si512(a, _mm512_maskz_alignr_epi64(0xFF, a, a, 1));
+  return _mm512_test_epi64_mask(a,
+                                _mm512_set_epi64(128, 64, 32, 16, 8, 4, 2, 1));
+}
+
+/*!
+ * Add the values of the lanes to target at their bins, which may repeat.
+ * vpconflictq gives each lane the earlier lanes holding the same bin; each
+ * lane sums the values of those lanes by pointer jumping along its nearest
+ * earlier duplicate, which takes three steps for eight lanes.  The last
+ * lane of each bin then holds the bin's total, and only those lanes update
+ * the target, with a gather and a scatter that cannot collide.
+ */
+template <typename T>
+RAJA_INLINE void scatter_add_lanes(T *target,
+                                   Index_type const *bins,
+                                   T const *values,
+                                   std::true_type)
+{
+  static_assert(sizeof(Index_type) == 8, "bins must be 64-bit lanes");
+  using vector = ScatterVector<T>;
+
+  const __m512i bin = _mm512_load_si512(bins);
+  typename vector::type value = vector::load(values);
+  const __m512i conflicts = _mm512_conflict_epi64(bin);
+  __mmask8 repeated = _mm512_test_epi64_mask(conflicts, conflicts);
+  __mmask8 last = 0xFF;
+  if (repeated) {
+    const __m512i none = _mm512_set1_epi64(-1);
+    __m512i prev = _mm512_sub_epi64(_mm512_set1_epi64(63),
+                                    _mm512_lzcnt_epi64(conflicts));
+    for (int step = 0; step < 3; ++step) {
+      value = vector::add(value, repeated, vector::permute(prev, value));
+      prev = _mm512_mask_permutexvar_epi64(none, repeated, prev, prev);
+      repeated = _mm512_cmpge_epi64_mask(prev, _mm512_setzero_si512());
+    }
+    last = static_cast<__mmask8>(~scatter_repeated_later(conflicts));
+  }
+  vector::update(target, last, bin, value);
+}
+
+#endif  // RAJA_HAVE_AVX512_CONFLICT
+
+//! add the values of the lanes to target at their bins one lane at a time
+template <typename T>
+RAJA_INLINE void scatter_add_lanes(T *target,
+                                   Index_type const *bins,
+                                   T const *values,
+                                   std::false_type)
+{
+  for (camp::idx_t l = 0; l < scatter_lanes; ++l) {
+    target[bins[l]] += values[l];
+  }
+}
+
+/*!
+ * The loop body computes the bins and values of scatter_lanes iterations
+ * in a vectorized loop, into lanes that are then added to the target.
+ */
+template <typename ExecPolicy, typename Iter, typename T, typename Body>
+concepts::enable_if<type_traits::is_simd_exec<ExecPolicy>> scatter_add(
+    const ExecPolicy &,
+    Iter begin,
+    Index_type n,
+    T *target,
+    Body const &body)
+{
+  using combine = std::integral_constant<bool, ScatterVector<T>::available>;
+
+  const Index_type full = n - n % scatter_lanes;
+  for (Index_type base = 0; base < full; base += scatter_lanes) {
+    alignas(64) Index_type bins[scatter_lanes];
+    alignas(64) T values[scatter_lanes];
+    RAJA_SIMD
+    for (camp::idx_t l = 0; l < scatter_lanes; ++l) {
+      body(*(begin + (base + l)), bins[l], values[l]);
+    }
+    scatter_add_lanes(target, bins, values, combine{});
+  }
+  for (Index_type i = full; i < n; ++i) {
+    Index_type bin;
+    T value;
+    body(*(begin + i), bin, value);
+    target[bin] += value;
+  }
+}
+
+template <typename ExecPolicy, typename Iter, typename T, typename Body>
+concepts::enable_if<is_serial_scatter_policy<ExecPolicy>> scatter_add(
+    const ExecPolicy &,
+    Iter begin,
+    Index_type n,
+    T *target,
+    Body const &body)
+{
+  for (Index_type i = 0; i < n; ++i) {
+    Index_type bin;
+    T value;
+    body(*(begin + i), bin, value);
+    target[bin] += value;
+  }
+}
+
+//! parallel policies add each value with an atomic
+template <typename ExecPolicy, typename Iter, typename T, typename Body>
+concepts::enable_if<
+    concepts::negate<type_traits::is_simd_exec<ExecPolicy>>,
+    concepts::negate<is_serial_scatter_policy<ExecPolicy>>>
+scatter_add(const ExecPolicy &p,
+            Iter begin,
+            Index_type n,
+            T *target,
+            Body const &body)
+{
+  forall(p, RangeSegment(0, n), [=](Index_type i) {
+    Index_type bin;
+    T value;
+    body(*(begin + i), bin, value);
+    RAJA::atomicAdd<auto_atomic>(target + bin, value);
+  });
+}
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  scatter-add execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Iteration space, such as a RangeSegment
+* \param[in,out] target Pointer to the bins the values are added to
+* \param[in] body Loop body called as body(i, bin, value) for each i in c,
+*which sets the Index_type bin and the T value to add to target[bin]
+*
+* Tallies and histograms, whose iterations may add to the same bin, run
+* vectorized under simd_exec: the bodies of eight iterations are run in a
+* vectorized loop, and their values are added with the bins repeated among
+* them combined first, using the AVX-512 conflict detection instructions
+* where available (for double and 64-bit integer values).  Sequential and
+* loop policies add each value in turn; parallel policies add each value
+* with an auto_atomic atomic.
+*
+* The values of one bin may be added in a different order than the
+* iterations, which can change the rounding of floating point sums.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Container, typename T, typename Body>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>>
+scatter_add(const ExecPolicy &p, Container &&c, T *target, Body body)
+{
+  auto begin = std::begin(c);
+  const Index_type n = std::distance(begin, std::end(c));
+  if (n <= 0) return;
+  detail::scatter_add(p, begin, n, target, body);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>> scatter_add(
+    Args &&... args)
+{
+  RAJA::scatter_add(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,387 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA batched sorted-search declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_search_HPP
+#define RAJA_search_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "camp/concepts.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! number of queries searched together, each search hiding the others'
+//! memory latency
+constexpr int search_group_size = 16;
+
+//! number of queries handled by each task of a batched search
+constexpr Index_type search_block_size = 1024;
+
+/*!
+ * Whether the bound for key lies after the table value t: t < key for a
+ * lower bound, !(key < t) for an upper bound.
+ */
+template <bool Upper>
+struct bound_side;
+
+template <>
+struct bound_side<false> {
+  template <typename T, typename Key, typename Compare>
+  static RAJA_INLINE bool after(T const &t, Key const &key, Compare comp)
+  {
+    return comp(t, key);
+  }
+};
+
+template <>
+struct bound_side<true> {
+  template <typename T, typename Key, typename Compare>
+  static RAJA_INLINE bool after(T const &t, Key const &key, Compare comp)
+  {
+    return !comp(key, t);
+  }
+};
+
+/*!
+ * Branchless binary search of the n > 0 element table for the bound of
+ * key: every step halves the range with a select rather than a branch, so
+ * the number of steps depends only on n.
+ */
+template <bool Upper, typename TableIter, typename Key, typename Compare>
+RAJA_INLINE Index_type bound_one(TableIter table,
+                                 Index_type n,
+                                 Key const &key,
+                                 Compare comp)
+{
+  Index_type base = 0;
+  for (Index_type len = n; len > 1;) {
+    const Index_type half = len / 2;
+    base += bound_side<Upper>::after(*(table + (base + half)), key, comp)
+                ? half
+                : 0;
+    len -= half;
+  }
+  return base + bound_side<Upper>::after(*(table + base), key, comp);
+}
+
+/*!
+ * Bounds of queries [q0, q0 + m), m <= search_group_size, in the n > 0
+ * element table.  The branchless searches of the group advance in lock
+ * step, so their table reads are independent and the cache misses of the
+ * whole group are outstanding at once.  (Software prefetching of the next
+ * candidates on top of this measured slower.)
+ */
+template <bool Upper,
+          typename TableIter,
+          typename QueryIter,
+          typename OutIter,
+          typename Compare>
+RAJA_INLINE void bound_group(TableIter table,
+                             Index_type n,
+                             QueryIter queries,
+                             OutIter out,
+                             Index_type q0,
+                             int m,
+                             Compare comp)
+{
+  Index_type base[search_group_size];
+  for (int g = 0; g < m; ++g) {
+    base[g] = 0;
+  }
+  for (Index_type len = n; len > 1;) {
+    const Index_type half = len / 2;
+    for (int g = 0; g < m; ++g) {
+      base[g] += bound_side<Upper>::after(
+                     *(table + (base[g] + half)), *(queries + (q0 + g)), comp)
+                     ? half
+                     : 0;
+    }
+    len -= half;
+  }
+  for (int g = 0; g < m; ++g) {
+    *(out + (q0 + g)) =
+        base[g]
+        + bound_side<Upper>::after(
+              *(table + base[g]), *(queries + (q0 + g)), comp);
+  }
+}
+
+/*!
+ * Bounds of the sorted queries [q0, q1) in the n > 0 element table.  The
+ * first query is searched in the whole table; each later one gallops
+ * forward from the bound before it and finishes with a binary search of
+ * the bracket, so dense queries cost a step or two each, like a merge,
+ * and sparse ones a logarithm of the distance between them.
+ */
+template <bool Upper,
+          typename TableIter,
+          typename QueryIter,
+          typename OutIter,
+          typename Compare>
+void bound_sorted_block(TableIter table,
+                        Index_type n,
+                        QueryIter queries,
+                        OutIter out,
+                        Index_type q0,
+                        Index_type q1,
+                        Compare comp)
+{
+  Index_type pos = bound_one<Upper>(table, n, *(queries + q0), comp);
+  *(out + q0) = pos;
+  for (Index_type q = q0 + 1; q < q1; ++q) {
+    auto const &key = *(queries + q);
+    if (pos < n && bound_side<Upper>::after(*(table + pos), key, comp)) {
+      // gallop until the entry at hi is not before the bound, then
+      // search [lo, hi)
+      Index_type lo = pos + 1;
+      Index_type step = 1;
+      Index_type hi = std::min(n, lo);
+      while (hi < n && bound_side<Upper>::after(*(table + hi), key, comp)) {
+        lo = hi + 1;
+        step *= 2;
+        hi = std::min(n, lo + step - 1);
+      }
+      pos = lo;
+      if (hi > lo) {
+        pos += bound_one<Upper>(table + lo, hi - lo, key, comp);
+      }
+    }
+    *(out + q) = pos;
+  }
+}
+
+template <bool Upper,
+          bool Sorted,
+          typename ExecPolicy,
+          typename TableIter,
+          typename QueryIter,
+          typename OutIter,
+          typename Compare>
+void bound_batch(const ExecPolicy &p,
+                 TableIter table,
+                 Index_type table_len,
+                 QueryIter queries,
+                 Index_type nqueries,
+                 OutIter out,
+                 Compare comp)
+{
+  if (nqueries <= 0) return;
+  if (table_len <= 0) {
+    forall(p, RangeSegment(0, nqueries), [=](Index_type q) {
+      *(out + q) = 0;
+    });
+    return;
+  }
+
+  const Index_type nblocks =
+      (nqueries + search_block_size - 1) / search_block_size;
+  forall(p, RangeSegment(0, nblocks), [=](Index_type b) {
+    const Index_type q0 = b * search_block_size;
+    const Index_type q1 = std::min(nqueries, q0 + search_block_size);
+    if (Sorted) {
+      bound_sorted_block<Upper>(table, table_len, queries, out, q0, q1, comp);
+    } else {
+      for (Index_type q = q0; q < q1; q += search_group_size) {
+        const int m = static_cast<int>(
+            std::min<Index_type>(search_group_size, q1 - q));
+        bound_group<Upper>(table, table_len, queries, out, q, m, comp);
+      }
+    }
+  });
+}
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  batched lower bound execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] table Pointer or Random-Access Iterator to a sorted table
+* \param[in] table_len number of table entries
+* \param[in] queries Pointer or Random-Access Iterator to the values to look
+*up
+* \param[in] nqueries number of queries
+* \param[out] out Pointer or Random-Access Iterator receiving, for each
+*query, the index of the first table entry that is not less than it
+* \param[in] comp comparison function the table is sorted by
+*
+* Queries are searched in groups whose branchless binary searches run in
+* lock step, which overlaps their reads of the table; groups are spread
+* over the execution policy.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename TableIter,
+          typename QueryIter,
+          typename OutIter,
+          typename Compare = operators::less<detail::IterVal<TableIter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<TableIter>,
+                    type_traits::is_iterator<QueryIter>,
+                    type_traits::is_iterator<OutIter>>
+lower_bound_batch(const ExecPolicy &p,
+                  TableIter table,
+                  Index_type table_len,
+                  QueryIter queries,
+                  Index_type nqueries,
+                  OutIter out,
+                  Compare comp = Compare{})
+{
+  detail::bound_batch<false, false>(
+      p, table, table_len, queries, nqueries, out, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  batched upper bound execution pattern
+*
+* As lower_bound_batch, with out receiving the index of the first table
+* entry that is greater than each query.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename TableIter,
+          typename QueryIter,
+          typename OutIter,
+          typename Compare = operators::less<detail::IterVal<TableIter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<TableIter>,
+                    type_traits::is_iterator<QueryIter>,
+                    type_traits::is_iterator<OutIter>>
+upper_bound_batch(const ExecPolicy &p,
+                  TableIter table,
+                  Index_type table_len,
+                  QueryIter queries,
+                  Index_type nqueries,
+                  OutIter out,
+                  Compare comp = Compare{})
+{
+  detail::bound_batch<true, false>(
+      p, table, table_len, queries, nqueries, out, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  batched lower bound execution pattern for sorted queries
+*
+* As lower_bound_batch, for queries sorted by comp.  Each block of queries
+* is searched with one binary search followed by a merge-like sweep of the
+* table that gallops over the entries between consecutive queries.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename TableIter,
+          typename QueryIter,
+          typename OutIter,
+          typename Compare = operators::less<detail::IterVal<TableIter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<TableIter>,
+                    type_traits::is_iterator<QueryIter>,
+                    type_traits::is_iterator<OutIter>>
+lower_bound_batch_sorted(const ExecPolicy &p,
+                         TableIter table,
+                         Index_type table_len,
+                         QueryIter queries,
+                         Index_type nqueries,
+                         OutIter out,
+                         Compare comp = Compare{})
+{
+  detail::bound_batch<false, true>(
+      p, table, table_len, queries, nqueries, out, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  batched upper bound execution pattern for sorted queries
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename TableIter,
+          typename QueryIter,
+          typename OutIter,
+          typename Compare = operators::less<detail::IterVal<TableIter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<TableIter>,
+                    type_traits::is_iterator<QueryIter>,
+                    type_traits::is_iterator<OutIter>>
+upper_bound_batch_sorted(const ExecPolicy &p,
+                         TableIter table,
+                         Index_type table_len,
+                         QueryIter queries,
+                         Index_type nqueries,
+                         OutIter out,
+                         Compare comp = Compare{})
+{
+  detail::bound_batch<true, true>(
+      p, table, table_len, queries, nqueries, out, comp);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+lower_bound_batch(Args &&... args)
+{
+  RAJA::lower_bound_batch(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+upper_bound_batch(Args &&... args)
+{
+  RAJA::upper_bound_batch(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+lower_bound_batch_sorted(Args &&... args)
+{
+  RAJA::lower_bound_batch_sorted(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>>
+upper_bound_batch_sorted(Args &&... args)
+{
+  RAJA::upper_bound_batch_sorted(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,496 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA selection (nth element and
+*          percentile) declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_select_HPP
+#define RAJA_select_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "camp/concepts.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/compact.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/scan.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! inputs shorter than this are selected from by a single thread
+constexpr Index_type select_serial_threshold = 1 << 15;
+
+//! number of elements handled by each task of a selection pass
+constexpr Index_type select_block_size = 1 << 14;
+
+//! size of the sample the pivots of a selection are taken from
+constexpr Index_type select_samples = 4096;
+
+//! sample ranks between the target rank and each pivot; about four
+//! standard deviations of the rank of the target in the sample
+constexpr Index_type select_sample_margin = 128;
+
+//! most counters of the per-block histograms of percentile_approx
+constexpr Index_type select_histogram_budget = 1 << 22;
+
+//! most bins of the histogram of percentile_approx
+constexpr Index_type select_max_bins = 1 << 21;
+
+template <typename ExecPolicy>
+struct is_serial_select_policy
+    : std::integral_constant<
+          bool,
+          type_traits::is_sequential_policy<ExecPolicy>::value
+              || type_traits::is_loop_policy<ExecPolicy>::value> {
+};
+
+/*!
+ * Classes of a three-way split around the pivots lo and hi: 0 below lo,
+ * 1 in the band between them, 2 above hi.  A missing pivot leaves its
+ * side of the band open.
+ */
+template <typename T, typename Compare>
+struct SelectBand {
+  T lo;
+  T hi;
+  bool has_lo;
+  bool has_hi;
+  Compare comp;
+
+  //! computed without branches, which would be mispredicted about half
+  //! the time on unordered data
+  RAJA_INLINE int operator()(T const &x) const
+  {
+    return 1 - static_cast<int>(has_lo & comp(x, lo))
+           + static_cast<int>(has_hi & comp(hi, x));
+  }
+};
+
+/*!
+ * Pivots whose band holds the element of rank k of [begin, begin + n)
+ * with high probability, from the sorted sample of every (n / s)-th
+ * element.
+ */
+template <typename Iter, typename Compare>
+SelectBand<IterVal<Iter>, Compare> select_band(Iter begin,
+                                               Index_type n,
+                                               Index_type k,
+                                               Compare comp)
+{
+  using T = IterVal<Iter>;
+  const Index_type s = std::min(n, select_samples);
+  std::vector<T> sample;
+  sample.reserve(s);
+  for (Index_type j = 0; j < s; ++j) {
+    sample.push_back(*(begin + (j * n / s)));
+  }
+  std::sort(sample.begin(), sample.end(), comp);
+
+  const Index_type r = k * s / n;
+  const Index_type lo = r - select_sample_margin;
+  const Index_type hi = r + select_sample_margin;
+  return SelectBand<T, Compare>{sample[std::max<Index_type>(lo, 0)],
+                                sample[std::min(hi, s - 1)],
+                                lo > 0,
+                                hi < s - 1,
+                                comp};
+}
+
+/*!
+ * Count the elements of each block in each class of band, storing the
+ * counts class-major, so that one exclusive scan leaves in
+ * offsets[c * nblocks + b] the position of the first element of class c
+ * of block b in the three-way split.  offsets[nblocks] is then the number
+ * of elements below the band and offsets[2 * nblocks] the number not
+ * above it.  Returns nblocks.
+ */
+template <typename ExecPolicy, typename Iter, typename Band>
+Index_type select_offsets(const ExecPolicy &p,
+                          Iter begin,
+                          Index_type n,
+                          Band band,
+                          std::vector<Index_type> &offsets)
+{
+  const Index_type nblocks = (n + select_block_size - 1) / select_block_size;
+  offsets.assign(3 * nblocks + 1, 0);
+  Index_type *counts = offsets.data();
+
+  forall(p, RangeSegment(0, nblocks), [=](Index_type b) {
+    const Index_type i0 = b * select_block_size;
+    const Index_type i1 = std::min(n, i0 + select_block_size);
+    Index_type c[3] = {0, 0, 0};
+    for (Index_type i = i0; i < i1; ++i) {
+      ++c[band(*(begin + i))];
+    }
+    counts[b] = c[0];
+    counts[nblocks + b] = c[1];
+    counts[2 * nblocks + b] = c[2];
+  });
+
+  impl::scan::exclusive_inplace(seq_exec{},
+                                counts,
+                                counts + 3 * nblocks + 1,
+                                operators::plus<Index_type>{},
+                                Index_type(0));
+  return nblocks;
+}
+
+/*!
+ * Scatter each block to its place in the three-way split using the
+ * offsets from select_offsets.  With BandOnly set only the band is
+ * written, to out[0, band size).
+ */
+template <bool BandOnly,
+          typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename Band>
+void select_scatter(const ExecPolicy &p,
+                    Iter begin,
+                    Index_type n,
+                    OutIter out,
+                    Band band,
+                    std::vector<Index_type> const &offsets)
+{
+  const Index_type nblocks = (offsets.size() - 1) / 3;
+  const Index_type *starts = offsets.data();
+
+  forall(p, RangeSegment(0, nblocks), [=](Index_type b) {
+    const Index_type i0 = b * select_block_size;
+    const Index_type i1 = std::min(n, i0 + select_block_size);
+    const Index_type base = BandOnly ? starts[nblocks] : 0;
+    Index_type pos[3] = {starts[b] - base,
+                         starts[nblocks + b] - base,
+                         starts[2 * nblocks + b] - base};
+    for (Index_type i = i0; i < i1; ++i) {
+      const int c = band(*(begin + i));
+      if (!BandOnly || c == 1) {
+        *(out + pos[c]++) = *(begin + i);
+      }
+    }
+  });
+}
+
+//! rank of the q-quantile of n elements: floor(q * (n - 1)), clamped
+RAJA_INLINE Index_type quantile_rank(double q, Index_type n)
+{
+  const double r = std::floor(q * static_cast<double>(n - 1));
+  if (r <= 0.0) return 0;
+  if (r >= static_cast<double>(n - 1)) return n - 1;
+  return static_cast<Index_type>(r);
+}
+
+}  // namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  nth element execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] nth Pointer or Random-Access Iterator to the position to select
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] comp comparison function, a strict weak ordering
+*
+* Rearranges the range like std::nth_element: nth receives the element that
+* would be there if the range were sorted, no element before it is greater
+* and no element after it is less.
+*
+* Parallel policies pick two pivots from a sorted sample so that the band
+* between them holds the element sought and a small fraction of the
+* input.  One pass counts each block's elements below, in and above the
+* band, a second splits the range three ways through a buffer, and only
+* the band is left to std::nth_element.  Should the band miss, the whole
+* range is handed to std::nth_element.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare = operators::less<detail::IterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>>
+nth_element(const ExecPolicy &p,
+            Iter begin,
+            Iter nth,
+            Iter end,
+            Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  using T = detail::IterVal<Iter>;
+  const Index_type n = end - begin;
+  const Index_type k = nth - begin;
+  if (k < 0 || k >= n) return;
+  if (detail::is_serial_select_policy<ExecPolicy>::value
+      || n < detail::select_serial_threshold) {
+    std::nth_element(begin, nth, end, comp);
+    return;
+  }
+
+  const auto band = detail::select_band(begin, n, k, comp);
+  std::vector<Index_type> offsets;
+  const Index_type nblocks =
+      detail::select_offsets(p, begin, n, band, offsets);
+  const Index_type band_begin = offsets[nblocks];
+  const Index_type band_end = offsets[2 * nblocks];
+  if (k < band_begin || k >= band_end) {
+    std::nth_element(begin, nth, end, comp);
+    return;
+  }
+
+  std::vector<T> parts(n);
+  detail::select_scatter<false>(p, begin, n, parts.data(), band, offsets);
+  detail::move_back(p, parts.data(), n, begin);
+  std::nth_element(begin + band_begin, nth, begin + band_end, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  percentile execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] q fraction in [0, 1], e.g. 0.5 for the median
+* \param[in] comp comparison function, a strict weak ordering
+*
+* \return the element of rank floor(q * (n - 1)) of the n elements, i.e.
+*the element that would be at that index if the range were sorted, or a
+*value-initialized element if the range is empty
+*
+* The range is not modified.  Parallel policies select as nth_element
+* does, but copy only the band between the pivots.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare = operators::less<detail::IterVal<Iter>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value,
+                        detail::IterVal<Iter>>::type
+percentile(const ExecPolicy &p,
+           Iter begin,
+           Iter end,
+           double q,
+           Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  using T = detail::IterVal<Iter>;
+  const Index_type n = end - begin;
+  if (n <= 0) return T();
+  const Index_type k = detail::quantile_rank(q, n);
+
+  std::vector<T> band_values;
+  Index_type rank = k;
+  if (!detail::is_serial_select_policy<ExecPolicy>::value
+      && n >= detail::select_serial_threshold) {
+    const auto band = detail::select_band(begin, n, k, comp);
+    std::vector<Index_type> offsets;
+    const Index_type nblocks =
+        detail::select_offsets(p, begin, n, band, offsets);
+    const Index_type band_begin = offsets[nblocks];
+    const Index_type band_end = offsets[2 * nblocks];
+    if (k >= band_begin && k < band_end) {
+      band_values.resize(band_end - band_begin);
+      detail::select_scatter<true>(
+          p, begin, n, band_values.data(), band, offsets);
+      rank = k - band_begin;
+    }
+  }
+  if (band_values.empty()) {
+    band_values.assign(begin, end);
+  }
+  std::nth_element(
+      band_values.begin(), band_values.begin() + rank, band_values.end(), comp);
+  return band_values[rank];
+}
+
+/*!
+******************************************************************************
+*
+* \brief  approximate percentile execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] q fraction in [0, 1], e.g. 0.95 for the 95th percentile
+* \param[in] lo lower end of the range of values to resolve
+* \param[in] hi upper end of the range of values to resolve
+* \param[in] tolerance largest acceptable error of the result
+*
+* \return a value within tolerance of the element of rank floor(q * (n - 1)),
+*provided that element lies in [lo, hi], or zero if the range is empty
+*
+* Makes a single pass over the data, counting the values into a histogram
+* of [lo, hi] with bins 2 * tolerance wide, and returns the middle of the
+* bin holding the rank sought.  Values outside [lo, hi] are counted in the
+* end bins.  A tolerance below (hi - lo) / 2^22 is raised to it.
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Iter>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<Iter>::value,
+                        detail::IterVal<Iter>>::type
+percentile_approx(const ExecPolicy &p,
+                  Iter begin,
+                  Iter end,
+                  double q,
+                  double lo,
+                  double hi,
+                  double tolerance)
+{
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  using T = detail::IterVal<Iter>;
+  static_assert(std::is_arithmetic<T>::value,
+                "percentile_approx requires arithmetic values");
+  const Index_type n = end - begin;
+  if (n <= 0) return T();
+  const Index_type k = detail::quantile_rank(q, n);
+
+  const double range = std::max(hi - lo, 0.0);
+  double width = std::max(2.0 * tolerance, range / detail::select_max_bins);
+  if (!(width > 0.0)) width = 1.0;
+  const Index_type nbins = std::max<Index_type>(
+      1, static_cast<Index_type>(std::ceil(range / width)));
+
+  // blocks count into their own histograms; there are fewer blocks the
+  // more bins there are, to bound the memory used
+  const Index_type nblocks = std::max<Index_type>(
+      1,
+      std::min((n + detail::select_block_size - 1) / detail::select_block_size,
+               detail::select_histogram_budget / nbins));
+  const Index_type chunk = (n + nblocks - 1) / nblocks;
+  std::vector<Index_type> block_counts(nblocks * nbins, 0);
+  Index_type *counts = block_counts.data();
+
+  forall(p, RangeSegment(0, nblocks), [=](Index_type b) {
+    Index_type *local = counts + b * nbins;
+    const Index_type i0 = std::min(n, b * chunk);
+    const Index_type i1 = std::min(n, i0 + chunk);
+    for (Index_type i = i0; i < i1; ++i) {
+      const double x = static_cast<double>(*(begin + i));
+      const double f = std::floor((x - lo) / width);
+      const Index_type bin =
+          f <= 0.0 ? 0
+                   : (f >= static_cast<double>(nbins - 1)
+                          ? nbins - 1
+                          : static_cast<Index_type>(f));
+      ++local[bin];
+    }
+  });
+
+  std::vector<Index_type> hist(nbins);
+  Index_type *h = hist.data();
+  forall(p, RangeSegment(0, nbins), [=](Index_type bin) {
+    Index_type sum = 0;
+    for (Index_type b = 0; b < nblocks; ++b) {
+      sum += counts[b * nbins + bin];
+    }
+    h[bin] = sum;
+  });
+
+  Index_type bin = 0;
+  for (Index_type seen = hist[0]; seen <= k && bin < nbins - 1;) {
+    seen += hist[++bin];
+  }
+  const double mid = lo + (static_cast<double>(bin) + 0.5) * width;
+  return static_cast<T>(std::min(std::max(mid, lo), std::max(lo, hi)));
+}
+
+// =============================================================================
+
+template <typename ExecPolicy,
+          typename Container,
+          typename Compare = operators::less<detail::ContainerVal<Container>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        detail::ContainerVal<Container>>::type
+percentile(const ExecPolicy &p,
+           Container const &c,
+           double q,
+           Compare comp = Compare{})
+{
+  return RAJA::percentile(p, std::begin(c), std::end(c), q, comp);
+}
+
+template <typename ExecPolicy, typename Container>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<Container>::value,
+                        detail::ContainerVal<Container>>::type
+percentile_approx(const ExecPolicy &p,
+                  Container const &c,
+                  double q,
+                  double lo,
+                  double hi,
+                  double tolerance)
+{
+  return RAJA::percentile_approx(
+      p, std::begin(c), std::end(c), q, lo, hi, tolerance);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>> nth_element(
+    Args &&... args)
+{
+  RAJA::nth_element(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto percentile(Args &&... args) -> typename std::enable_if<
+    type_traits::is_execution_policy<ExecPolicy>::value,
+    decltype(RAJA::percentile(ExecPolicy{},
+                              std::forward<Args>(args)...))>::type
+{
+  return RAJA::percentile(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto percentile_approx(Args &&... args) -> typename std::enable_if<
+    type_traits::is_execution_policy<ExecPolicy>::value,
+    decltype(RAJA::percentile_approx(ExecPolicy{},
+                                     std::forward<Args>(args)...))>::type
+{
+  return RAJA::percentile_approx(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,276 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort and merge declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_HPP
+#define RAJA_sort_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#include "camp/concepts.hpp"
+#include "camp/helpers.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/detail/sort.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/scan.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+******************************************************************************
+*
+* \brief  sort execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] comp comparison function, a strict weak ordering
+*
+* \note{The relative order of equivalent elements is unspecified}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare = operators::less<detail::IterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>>
+sort(const ExecPolicy &p, Iter begin, Iter end, Compare comp = Compare{})
+{
+  using R = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  impl::sort::unstable(p, begin, end, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] begin Pointer or Random-Access Iterator to start of data range
+* \param[in,out] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[in] comp comparison function, a strict weak ordering
+*
+* \note{Equivalent elements keep their relative order}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Compare = operators::less<detail::IterVal<Iter>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_iterator<Iter>>
+stable_sort(const ExecPolicy &p, Iter begin, Iter end, Compare comp = Compare{})
+{
+  using R = detail::IterVal<Iter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, R, R>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  impl::sort::stable(p, begin, end, comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  sort execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] c RandomAccess Container
+* \param[in] comp comparison function, a strict weak ordering
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename Compare = operators::less<detail::ContainerVal<Container>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>>
+sort(const ExecPolicy &p, Container &c, Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  RAJA::sort(p, std::begin(c), std::end(c), comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable sort execution pattern
+*
+* \param[in] p Execution policy
+* \param[in,out] c RandomAccess Container
+* \param[in] comp comparison function, a strict weak ordering
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename Compare = operators::less<detail::ContainerVal<Container>>>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>>
+stable_sort(const ExecPolicy &p, Container &c, Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  RAJA::stable_sort(p, std::begin(c), std::end(c), comp);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  merge execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] a_begin Pointer or Random-Access Iterator to start of the first
+*sorted range
+* \param[in] a_end Pointer or Random-Access Iterator to end of the first
+*sorted range (exclusive)
+* \param[in] b_begin Pointer or Random-Access Iterator to start of the second
+*sorted range
+* \param[in] b_end Pointer or Random-Access Iterator to end of the second
+*sorted range (exclusive)
+* \param[out] out Pointer or Random-Access Iterator receiving the merged
+*range
+* \param[in] comp comparison function, a strict weak ordering
+*
+* \return the number of elements written
+*
+* The output is split into equal blocks that are merged independently; the
+* part of each input that goes to a block is found by binary search along
+* the merge path.  Of equivalent elements, those of the first range come
+* first.
+*
+* \note{The inputs must be separate from the output}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename IterA,
+          typename IterB,
+          typename IterOut,
+          typename Compare = operators::less<detail::IterVal<IterA>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_iterator<IterA>::value
+                            && type_traits::is_iterator<IterB>::value
+                            && type_traits::is_iterator<IterOut>::value,
+                        Index_type>::type
+merge(const ExecPolicy &p,
+      IterA a_begin,
+      IterA a_end,
+      IterB b_begin,
+      IterB b_end,
+      IterOut out,
+      Compare comp = Compare{})
+{
+  static_assert(type_traits::is_random_access_iterator<IterA>::value
+                    && type_traits::is_random_access_iterator<IterB>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  const Index_type na = a_end - a_begin;
+  const Index_type nb = b_end - b_begin;
+  const Index_type n = na + nb;
+  const Index_type nblocks =
+      (n + detail::merge_block_size - 1) / detail::merge_block_size;
+
+  forall(p, RangeSegment(0, nblocks), [=](Index_type blk) {
+    const Index_type o0 = blk * detail::merge_block_size;
+    const Index_type o1 = std::min(n, o0 + detail::merge_block_size);
+    const Index_type i0 =
+        detail::merge_rank(a_begin, na, b_begin, nb, o0, comp);
+    const Index_type i1 =
+        detail::merge_rank(a_begin, na, b_begin, nb, o1, comp);
+    std::merge(a_begin + i0,
+               a_begin + i1,
+               b_begin + (o0 - i0),
+               b_begin + (o1 - i1),
+               out + o0,
+               comp);
+  });
+  return n;
+}
+
+/*!
+******************************************************************************
+*
+* \brief  merge execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] a first sorted RandomAccess Container
+* \param[in] b second sorted RandomAccess Container
+* \param[out] out Pointer or Random-Access Iterator receiving the merged
+*range
+* \param[in] comp comparison function, a strict weak ordering
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename ContainerA,
+          typename ContainerB,
+          typename IterOut,
+          typename Compare = operators::less<detail::ContainerVal<ContainerA>>>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value
+                            && type_traits::is_range<ContainerA>::value
+                            && type_traits::is_range<ContainerB>::value,
+                        Index_type>::type
+merge(const ExecPolicy &p,
+      ContainerA &a,
+      ContainerB &b,
+      IterOut out,
+      Compare comp = Compare{})
+{
+  return RAJA::merge(
+      p, std::begin(a), std::end(a), std::begin(b), std::end(b), out, comp);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>> sort(
+    Args &&... args)
+{
+  RAJA::sort(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>> stable_sort(
+    Args &&... args)
+{
+  RAJA::stable_sort(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+typename std::enable_if<type_traits::is_execution_policy<ExecPolicy>::value,
+                        Index_type>::type
+merge(Args &&... args)
+{
+  return RAJA::merge(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
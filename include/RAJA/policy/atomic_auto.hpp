@@ -145,6 +145,22 @@ atomicCAS(auto_atomic, T volatile *acc, T compare, T value)
   return atomicCAS(RAJA_AUTO_ATOMIC, acc, compare, value);
 }
 
+template <typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T atomicMinLoc(auto_atomic,
+                                            T volatile *acc,
+                                            T value)
+{
+  return atomicMinLoc(RAJA_AUTO_ATOMIC, acc, value);
+}
+
+template <typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T atomicMaxLoc(auto_atomic,
+                                            T volatile *acc,
+                                            T value)
+{
+  return atomicMaxLoc(RAJA_AUTO_ATOMIC, acc, value);
+}
+
 
 }  // namespace RAJA
 
@@ -20,6 +20,17 @@
 
 #include "RAJA/config.hpp"
 
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+#if defined(RAJA_COMPILER_MSVC)
+#include <intrin.h>
+#endif
+
+#include "RAJA/util/AtomicStats.hpp"
 #include "RAJA/util/TypeConvert.hpp"
 #include "RAJA/util/macros.hpp"
 
@@ -29,6 +40,16 @@
 #define RAJA_DEVICE_HIP
 #endif
 
+/*!
+ * Defined when 16-byte compare-and-swap compiles to a lock-free instruction,
+ * e.g. cmpxchg16b on x86-64 built with -mcx16.  Otherwise 16-byte atomics
+ * fall back to striped locks.
+ */
+#if !defined(RAJA_COMPILER_MSVC) && defined(__SIZEOF_INT128__) \
+    && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+#define RAJA_HAVE_BUILTIN_ATOMIC_CAS16
+#endif
+
 namespace RAJA
 {
 
@@ -37,11 +58,67 @@ namespace RAJA
 struct builtin_atomic {
 };
 
+/*!
+ * Atomic policy that uses the compilers builtin __atomic_XXX routines with
+ * relaxed memory ordering: each operation is atomic, but orders no other
+ * memory accesses.  Suited to counters and histogram bins that are only
+ * read after the loop updating them has completed.
+ */
+struct builtin_atomic_relaxed {
+};
+
+/*!
+ * Atomic policy that uses the compilers builtin __atomic_XXX routines, as
+ * builtin_atomic, but whose compare-and-swap loops back off exponentially
+ * between retries: first by spinning on pause hints, then, once the spins
+ * reach a bound, by yielding the processor.  Suited to many threads
+ * updating few targets, where retrying at once only keeps the target's
+ * cache line moving between them.  Host only.
+ */
+struct builtin_atomic_backoff {
+};
+
 namespace detail
 {
 
 #if defined(RAJA_COMPILER_MSVC)
+// the interlocked intrinsics are full barriers, so the order is unused
+constexpr int builtin_order_acq_rel = 0;
+constexpr int builtin_order_relaxed = 0;
+#else
+constexpr int builtin_order_acq_rel = __ATOMIC_ACQ_REL;
+constexpr int builtin_order_relaxed = __ATOMIC_RELAXED;
+#endif
+
+//! memory order of the operations of each builtin atomic policy
+template <typename Policy>
+struct builtin_atomic_order {
+};
+
+template <>
+struct builtin_atomic_order<builtin_atomic>
+    : std::integral_constant<int, builtin_order_acq_rel> {
+};
 
+template <>
+struct builtin_atomic_order<builtin_atomic_relaxed>
+    : std::integral_constant<int, builtin_order_relaxed> {
+};
+
+template <>
+struct builtin_atomic_order<builtin_atomic_backoff>
+    : std::integral_constant<int, builtin_order_acq_rel> {
+};
+
+//! T when Policy is a builtin atomic policy, otherwise no type
+template <typename Policy, typename T>
+using builtin_atomic_result =
+    typename std::enable_if<(builtin_atomic_order<Policy>::value >= 0),
+                            T>::type;
+
+#if defined(RAJA_COMPILER_MSVC)
+
+template <int Order>
 RAJA_DEVICE_HIP
 RAJA_INLINE unsigned builtin_atomic_CAS(
                                unsigned volatile *acc,
@@ -57,6 +134,7 @@ RAJA_INLINE unsigned builtin_atomic_CAS(
   return RAJA::util::reinterp_A_as_B<long, unsigned>(old);
 }
 
+template <int Order>
 RAJA_DEVICE_HIP
 RAJA_INLINE unsigned long long builtin_atomic_CAS(
                                          unsigned long long volatile *acc,
@@ -78,6 +156,7 @@ RAJA_INLINE unsigned long long builtin_atomic_CAS(
 
 #else   // RAJA_COMPILER_MSVC
 
+template <int Order>
 RAJA_DEVICE_HIP
 RAJA_INLINE unsigned builtin_atomic_CAS(
                               unsigned volatile *acc,
@@ -85,10 +164,11 @@ RAJA_INLINE unsigned builtin_atomic_CAS(
                               unsigned value)
 {
   __atomic_compare_exchange_n(
-      acc, &compare, value, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+      acc, &compare, value, false, Order, __ATOMIC_RELAXED);
   return compare;
 }
 
+template <int Order>
 RAJA_DEVICE_HIP
 RAJA_INLINE unsigned long long builtin_atomic_CAS(
                               unsigned long long volatile *acc,
@@ -96,47 +176,110 @@ RAJA_INLINE unsigned long long builtin_atomic_CAS(
                               unsigned long long value)
 {
   __atomic_compare_exchange_n(
-      acc, &compare, value, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+      acc, &compare, value, false, Order, __ATOMIC_RELAXED);
   return compare;
 }
 
 #endif  // RAJA_COMPILER_MSVC
 
 
-template <typename T>
+template <int Order, typename T>
 RAJA_DEVICE_HIP
 RAJA_INLINE typename std::enable_if<sizeof(T) == sizeof(unsigned), T>::type
 builtin_atomic_CAS(T volatile *acc, T compare, T value)
 {
   return RAJA::util::reinterp_A_as_B<unsigned, T>(
-      builtin_atomic_CAS((unsigned volatile *)acc,
+      builtin_atomic_CAS<Order>((unsigned volatile *)acc,
           RAJA::util::reinterp_A_as_B<T, unsigned>(compare),
           RAJA::util::reinterp_A_as_B<T, unsigned>(value)));
 }
 
-template <typename T>
+template <int Order, typename T>
 RAJA_DEVICE_HIP
 RAJA_INLINE typename std::enable_if<sizeof(T) == sizeof(unsigned long long), T>::type
 builtin_atomic_CAS(T volatile *acc, T compare, T value)
 {
   return RAJA::util::reinterp_A_as_B<unsigned long long, T>(
-      builtin_atomic_CAS((unsigned long long volatile *)acc,
+      builtin_atomic_CAS<Order>((unsigned long long volatile *)acc,
           RAJA::util::reinterp_A_as_B<T, unsigned long long>(compare),
           RAJA::util::reinterp_A_as_B<T, unsigned long long>(value)));
 }
 
 
-template <size_t BYTES>
+//! hint to the processor that this thread is spinning
+RAJA_INLINE void builtin_cpu_relax()
+{
+#if defined(RAJA_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+  _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+/*!
+ * What a compare-and-swap loop does before retrying.  Each returns whether
+ * it waited, in which case the loop rereads the target rather than retrying
+ * with the value its failed CAS read.
+ */
+struct BuiltinRetryAtOnce {
+  RAJA_DEVICE_HIP
+  RAJA_INLINE bool operator()() const { return false; }
+};
+
+//! pause hints of the first backoff, doubled on each further retry
+constexpr unsigned builtin_backoff_min_spins = 4;
+
+//! retries after the pause hints reach this many yield the processor
+constexpr unsigned builtin_backoff_max_spins = 1024;
+
+class BuiltinBackoff
+{
+public:
+  RAJA_INLINE bool operator()()
+  {
+    if (spins_ > builtin_backoff_max_spins) {
+      std::this_thread::yield();
+      return true;
+    }
+    for (unsigned i = 0; i < spins_; ++i) {
+      builtin_cpu_relax();
+    }
+    spins_ *= 2;
+    return true;
+  }
+
+private:
+  unsigned spins_ = builtin_backoff_min_spins;
+};
+
+template <typename Policy>
+struct builtin_atomic_retry_policy {
+  using type = BuiltinRetryAtOnce;
+};
+
+template <>
+struct builtin_atomic_retry_policy<builtin_atomic_backoff> {
+  using type = BuiltinBackoff;
+};
+
+//! the retry policy of the compare-and-swap loops of each builtin policy
+template <typename Policy>
+using builtin_atomic_retry = typename builtin_atomic_retry_policy<Policy>::type;
+
+
+template <size_t BYTES, int Order, typename Retry>
 struct BuiltinAtomicCAS;
-template <size_t BYTES>
+template <size_t BYTES, int Order, typename Retry>
 struct BuiltinAtomicCAS {
-  static_assert(!(BYTES == 4 || BYTES == 8),
-                "builtin atomic cas assumes 4 or 8 byte targets");
+  static_assert(!(BYTES == 4 || BYTES == 8 || BYTES == 16),
+                "builtin atomic cas assumes 4, 8 or 16 byte targets");
 };
 
 
-template <>
-struct BuiltinAtomicCAS<4> {
+template <int Order, typename Retry>
+struct BuiltinAtomicCAS<4, Order, Retry> {
 
   /*!
    * Generic impementation of any atomic 32-bit operator.
@@ -150,15 +293,18 @@ struct BuiltinAtomicCAS<4> {
                            ShortCircuit const &sc) const
   {
     unsigned oldval, newval, readback;
+    Retry retry;
 
     oldval = RAJA::util::reinterp_A_as_B<T, unsigned>(*acc);
     newval = RAJA::util::reinterp_A_as_B<T, unsigned>(
         oper(RAJA::util::reinterp_A_as_B<unsigned, T>(oldval)));
 
-    while ((readback = builtin_atomic_CAS(
+    while ((readback = builtin_atomic_CAS<Order>(
                 (unsigned *)acc, oldval, newval)) != oldval) {
+      RAJA_ATOMIC_STATS_RETRY();
       if (sc(readback)) break;
-      oldval = readback;
+      oldval = retry() ? RAJA::util::reinterp_A_as_B<T, unsigned>(*acc)
+                       : readback;
       newval = RAJA::util::reinterp_A_as_B<T, unsigned>(
           oper(RAJA::util::reinterp_A_as_B<unsigned, T>(oldval)));
     }
@@ -166,8 +312,8 @@ struct BuiltinAtomicCAS<4> {
   }
 };
 
-template <>
-struct BuiltinAtomicCAS<8> {
+template <int Order, typename Retry>
+struct BuiltinAtomicCAS<8, Order, Retry> {
 
   /*!
    * Generic impementation of any atomic 64-bit operator.
@@ -181,15 +327,19 @@ struct BuiltinAtomicCAS<8> {
                            ShortCircuit const &sc) const
   {
     unsigned long long oldval, newval, readback;
+    Retry retry;
 
     oldval = RAJA::util::reinterp_A_as_B<T, unsigned long long>(*acc);
     newval = RAJA::util::reinterp_A_as_B<T, unsigned long long>(
         oper(RAJA::util::reinterp_A_as_B<unsigned long long, T>(oldval)));
 
-    while ((readback = builtin_atomic_CAS(
+    while ((readback = builtin_atomic_CAS<Order>(
                 (unsigned long long *)acc, oldval, newval)) != oldval) {
+      RAJA_ATOMIC_STATS_RETRY();
       if (sc(readback)) break;
-      oldval = readback;
+      oldval = retry()
+                   ? RAJA::util::reinterp_A_as_B<T, unsigned long long>(*acc)
+                   : readback;
       newval = RAJA::util::reinterp_A_as_B<T, unsigned long long>(
           oper(RAJA::util::reinterp_A_as_B<unsigned long long, T>(oldval)));
     }
@@ -199,145 +349,521 @@ struct BuiltinAtomicCAS<8> {
 
 
 /*!
- * Generic impementation of any atomic 32-bit or 64-bit operator that can be
- * implemented using a compare and swap primitive.
- * Implementation uses the builtin unsigned 32-bit and 64-bit CAS operators.
+ * The bits of a 16-byte target, such as a ValueLoc<double, Index_type>.
+ */
+struct BuiltinAtomicWord16 {
+  unsigned long long bits[2];
+
+  bool operator!=(BuiltinAtomicWord16 const &rhs) const
+  {
+    return bits[0] != rhs.bits[0] || bits[1] != rhs.bits[1];
+  }
+};
+
+template <typename T>
+RAJA_INLINE BuiltinAtomicWord16 builtin_word16(T const &value)
+{
+  BuiltinAtomicWord16 word;
+  std::memcpy(&word, &value, sizeof(word));
+  return word;
+}
+
+template <typename T>
+RAJA_INLINE T builtin_from_word16(BuiltinAtomicWord16 const &word)
+{
+  T value;
+  std::memcpy(static_cast<void *>(&value), &word, sizeof(word));
+  return value;
+}
+
+//! number of locks guarding 16-byte targets without lock-free atomics
+constexpr std::uintptr_t builtin_cas16_stripes = 64;
+
+struct alignas(64) BuiltinAtomicLock16 {
+  std::atomic<bool> locked;
+};
+
+//! the lock of the stripe holding address acc
+RAJA_INLINE BuiltinAtomicLock16 &builtin_cas16_lock(void const volatile *acc)
+{
+  static BuiltinAtomicLock16 locks[builtin_cas16_stripes];
+  return locks[(reinterpret_cast<std::uintptr_t>(acc) >> 4)
+               % builtin_cas16_stripes];
+}
+
+/*!
+ * 16-byte compare-and-swap, returning the old bits.  Uses cmpxchg16b (or the
+ * platform's equivalent) when available and acc is 16-byte aligned, which
+ * orders memory at least as strongly as Order; otherwise the target is
+ * updated under the lock of its stripe.  The mode depends only on the
+ * address, so all updates of one target agree.
+ */
+template <int Order>
+RAJA_INLINE BuiltinAtomicWord16 builtin_atomic_CAS16(
+    void volatile *acc,
+    BuiltinAtomicWord16 compare,
+    BuiltinAtomicWord16 value)
+{
+#if defined(RAJA_HAVE_BUILTIN_ATOMIC_CAS16)
+  if (reinterpret_cast<std::uintptr_t>(acc) % 16 == 0) {
+    unsigned __int128 c, v;
+    std::memcpy(&c, &compare, sizeof(c));
+    std::memcpy(&v, &value, sizeof(v));
+    const unsigned __int128 old = __sync_val_compare_and_swap(
+        static_cast<unsigned __int128 volatile *>(acc), c, v);
+    BuiltinAtomicWord16 word;
+    std::memcpy(&word, &old, sizeof(word));
+    return word;
+  }
+#endif
+  BuiltinAtomicLock16 &lock = builtin_cas16_lock(acc);
+  while (lock.locked.exchange(true, std::memory_order_acquire)) {
+    while (lock.locked.load(std::memory_order_relaxed)) {
+      builtin_cpu_relax();
+    }
+  }
+  void *target = const_cast<void *>(acc);
+  BuiltinAtomicWord16 old;
+  std::memcpy(&old, target, sizeof(old));
+  if (!(old != compare)) {
+    std::memcpy(target, &value, sizeof(value));
+  }
+  lock.locked.store(false, std::memory_order_release);
+  return old;
+}
+
+template <int Order, typename T>
+RAJA_INLINE typename std::enable_if<sizeof(T) == 16, T>::type
+builtin_atomic_CAS(T volatile *acc, T compare, T value)
+{
+  return builtin_from_word16<T>(builtin_atomic_CAS16<Order>(
+      acc, builtin_word16(compare), builtin_word16(value)));
+}
+
+template <int Order, typename Retry>
+struct BuiltinAtomicCAS<16, Order, Retry> {
+
+  /*!
+   * Generic impementation of any atomic 128-bit operator, for host targets.
+   * Implementation uses the 16-byte CAS operator above; the first read of
+   * the target, and any re-read by the retry policy, may be torn, which
+   * the CAS detects. Only pairs returned by the CAS are returned.
+   * Returns the OLD value that was replaced by the result of this operation.
+   */
+  template <typename T, typename OPER, typename ShortCircuit>
+  RAJA_INLINE T operator()(T volatile *acc,
+                           OPER const &oper,
+                           ShortCircuit const &sc) const
+  {
+    BuiltinAtomicWord16 oldval, newval, readback;
+    Retry retry;
+
+    std::memcpy(&oldval, const_cast<T *>(acc), sizeof(oldval));
+    newval = builtin_word16(oper(builtin_from_word16<T>(oldval)));
+
+    while ((readback = builtin_atomic_CAS16<Order>(acc, oldval, newval))
+           != oldval) {
+      RAJA_ATOMIC_STATS_RETRY();
+      if (sc(builtin_from_word16<T>(readback))) {
+        return builtin_from_word16<T>(readback);
+      }
+      if (retry()) {
+        std::memcpy(&readback, const_cast<T *>(acc), sizeof(readback));
+      }
+      oldval = readback;
+      newval = builtin_word16(oper(builtin_from_word16<T>(oldval)));
+    }
+    return builtin_from_word16<T>(oldval);
+  }
+};
+
+
+/*!
+ * Generic impementation of any atomic 32-bit, 64-bit or 128-bit operator that
+ * can be implemented using a compare and swap primitive.
+ * Implementation uses the builtin unsigned 32-bit and 64-bit CAS operators
+ * and the 128-bit CAS operator above.
  * Returns the OLD value that was replaced by the result of this operation.
  */
-template <typename T, typename OPER>
+template <int Order,
+          typename Retry = BuiltinRetryAtOnce,
+          typename T,
+          typename OPER>
 RAJA_DEVICE_HIP
 RAJA_INLINE T builtin_atomic_CAS_oper(T volatile *acc, OPER &&oper)
 {
-  BuiltinAtomicCAS<sizeof(T)> cas;
+  BuiltinAtomicCAS<sizeof(T), Order, Retry> cas;
   return cas(acc, std::forward<OPER>(oper), [](T const &) { return false; });
 }
 
-template <typename T, typename OPER, typename ShortCircuit>
+template <int Order,
+          typename Retry = BuiltinRetryAtOnce,
+          typename T,
+          typename OPER,
+          typename ShortCircuit>
 RAJA_DEVICE_HIP
 RAJA_INLINE T builtin_atomic_CAS_oper_sc(T volatile *acc,
                                          OPER &&oper,
                                          ShortCircuit const &sc)
 {
-  BuiltinAtomicCAS<sizeof(T)> cas;
+  BuiltinAtomicCAS<sizeof(T), Order, Retry> cas;
   return cas(acc, std::forward<OPER>(oper), sc);
 }
 
 
+/*!
+ * Whether T has native fetch-and-op builtins, which compile to a single
+ * locked instruction (e.g. lock xadd) instead of a compare-and-swap loop
+ * that retries under contention.  True for integral types other than bool.
+ */
+#if defined(RAJA_COMPILER_MSVC)
+template <typename T>
+struct builtin_atomic_native : std::false_type {
+};
+#else
+template <typename T>
+struct builtin_atomic_native
+    : std::integral_constant<bool,
+                             std::is_integral<T>::value
+                                 && !std::is_same<T, bool>::value> {
+};
+#endif
+
+/*!
+ * Native fetch-and-op operations for integral T and their compare-and-swap
+ * fallbacks, selected by builtin_atomic_native<T>.
+ * Each returns the OLD value that was replaced by the result.
+ */
+#if !defined(RAJA_COMPILER_MSVC)
+
+template <int Order, typename Retry, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_add(T volatile *acc,
+                                                       T value,
+                                                       std::true_type)
+{
+  return __atomic_fetch_add(acc, value, Order);
+}
+
+template <int Order, typename Retry, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_sub(T volatile *acc,
+                                                       T value,
+                                                       std::true_type)
+{
+  return __atomic_fetch_sub(acc, value, Order);
+}
+
+template <int Order, typename Retry, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_and(T volatile *acc,
+                                                       T value,
+                                                       std::true_type)
+{
+  return __atomic_fetch_and(acc, value, Order);
+}
+
+template <int Order, typename Retry, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_or(T volatile *acc,
+                                                      T value,
+                                                      std::true_type)
+{
+  return __atomic_fetch_or(acc, value, Order);
+}
+
+template <int Order, typename Retry, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_xor(T volatile *acc,
+                                                       T value,
+                                                       std::true_type)
+{
+  return __atomic_fetch_xor(acc, value, Order);
+}
+
+template <int Order, typename Retry, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_exchange(T volatile *acc,
+                                                      T value,
+                                                      std::true_type)
+{
+  return __atomic_exchange_n(acc, value, Order);
+}
+
+#endif  // RAJA_COMPILER_MSVC
+
+template <int Order, typename Retry, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_add(T volatile *acc,
+                                                       T value,
+                                                       std::false_type)
+{
+  return builtin_atomic_CAS_oper<Order, Retry>(
+      acc, [=](T a) { return a + value; });
+}
+
+template <int Order, typename Retry, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_sub(T volatile *acc,
+                                                       T value,
+                                                       std::false_type)
+{
+  return builtin_atomic_CAS_oper<Order, Retry>(
+      acc, [=](T a) { return a - value; });
+}
+
+template <int Order, typename Retry, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_and(T volatile *acc,
+                                                       T value,
+                                                       std::false_type)
+{
+  return builtin_atomic_CAS_oper<Order, Retry>(
+      acc, [=](T a) { return a & value; });
+}
+
+template <int Order, typename Retry, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_or(T volatile *acc,
+                                                      T value,
+                                                      std::false_type)
+{
+  return builtin_atomic_CAS_oper<Order, Retry>(
+      acc, [=](T a) { return a | value; });
+}
+
+template <int Order, typename Retry, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_fetch_xor(T volatile *acc,
+                                                       T value,
+                                                       std::false_type)
+{
+  return builtin_atomic_CAS_oper<Order, Retry>(
+      acc, [=](T a) { return a ^ value; });
+}
+
+template <int Order, typename Retry, typename T>
+RAJA_DEVICE_HIP RAJA_INLINE T builtin_atomic_exchange(T volatile *acc,
+                                                      T value,
+                                                      std::false_type)
+{
+  return builtin_atomic_CAS_oper<Order, Retry>(acc, [=](T) { return value; });
+}
+
+/*!
+ * Whether value-location pair a precedes b in a min (doing_min) or max
+ * search: a has the better value, or the same value and a smaller location,
+ * so that the result does not depend on the order of the updates.
+ */
+template <bool doing_min, typename T>
+RAJA_INLINE bool builtin_loc_before(T const &a, T const &b)
+{
+  if (doing_min ? a.val < b.val : b.val < a.val) return true;
+  if (doing_min ? b.val < a.val : a.val < b.val) return false;
+  return a.loc < b.loc;
+}
+
+
 }  // namespace detail
 
 
-template <typename T>
+/*!
+ * The operations below serve builtin_atomic, whose operations have
+ * acquire-release ordering, builtin_atomic_relaxed and
+ * builtin_atomic_backoff.
+ */
+template <typename Policy, typename T>
 RAJA_DEVICE_HIP
-RAJA_INLINE T atomicAdd(builtin_atomic, T volatile *acc, T value)
+RAJA_INLINE detail::builtin_atomic_result<Policy, T>
+atomicAdd(Policy, T volatile *acc, T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a + value; });
+  return detail::builtin_atomic_fetch_add<
+      detail::builtin_atomic_order<Policy>::value,
+      detail::builtin_atomic_retry<Policy>>(
+      acc, value, detail::builtin_atomic_native<T>{});
 }
 
 
-template <typename T>
+template <typename Policy, typename T>
 RAJA_DEVICE_HIP
-RAJA_INLINE T atomicSub(builtin_atomic, T volatile *acc, T value)
+RAJA_INLINE detail::builtin_atomic_result<Policy, T>
+atomicSub(Policy, T volatile *acc, T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a - value; });
+  return detail::builtin_atomic_fetch_sub<
+      detail::builtin_atomic_order<Policy>::value,
+      detail::builtin_atomic_retry<Policy>>(
+      acc, value, detail::builtin_atomic_native<T>{});
 }
 
-template <typename T>
+template <typename Policy, typename T>
 RAJA_DEVICE_HIP
-RAJA_INLINE T atomicMin(builtin_atomic, T volatile *acc, T value)
+RAJA_INLINE detail::builtin_atomic_result<Policy, T>
+atomicMin(Policy, T volatile *acc, T value)
 {
   if (*acc < value) {
     return *acc;
   }
-  return detail::builtin_atomic_CAS_oper_sc(acc,
-                                            [=](T a) {
-                                              return a < value ? a : value;
-                                            },
-                                            [=](T current) {
-                                              return current < value;
-                                            });
+  return detail::builtin_atomic_CAS_oper_sc<
+      detail::builtin_atomic_order<Policy>::value,
+      detail::builtin_atomic_retry<Policy>>(
+      acc,
+      [=](T a) { return a < value ? a : value; },
+      [=](T current) { return current < value; });
 }
 
-template <typename T>
+template <typename Policy, typename T>
 RAJA_DEVICE_HIP
-RAJA_INLINE T atomicMax(builtin_atomic, T volatile *acc, T value)
+RAJA_INLINE detail::builtin_atomic_result<Policy, T>
+atomicMax(Policy, T volatile *acc, T value)
 {
   if (*acc > value) {
     return *acc;
   }
-  return detail::builtin_atomic_CAS_oper_sc(acc,
-                                            [=](T a) {
-                                              return a > value ? a : value;
-                                            },
-                                            [=](T current) {
-                                              return current > value;
-                                            });
+  return detail::builtin_atomic_CAS_oper_sc<
+      detail::builtin_atomic_order<Policy>::value,
+      detail::builtin_atomic_retry<Policy>>(
+      acc,
+      [=](T a) { return a > value ? a : value; },
+      [=](T current) { return current > value; });
 }
 
-template <typename T>
+template <typename Policy, typename T>
 RAJA_DEVICE_HIP
-RAJA_INLINE T atomicInc(builtin_atomic, T volatile *acc)
+RAJA_INLINE detail::builtin_atomic_result<Policy, T>
+atomicInc(Policy, T volatile *acc)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a + 1; });
+  return detail::builtin_atomic_fetch_add<
+      detail::builtin_atomic_order<Policy>::value,
+      detail::builtin_atomic_retry<Policy>>(
+      acc, T(1), detail::builtin_atomic_native<T>{});
 }
 
-template <typename T>
+template <typename Policy, typename T>
 RAJA_DEVICE_HIP
-RAJA_INLINE T atomicInc(builtin_atomic, T volatile *acc, T val)
+RAJA_INLINE detail::builtin_atomic_result<Policy, T>
+atomicInc(Policy, T volatile *acc, T val)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T old) {
+  return detail::builtin_atomic_CAS_oper<
+      detail::builtin_atomic_order<Policy>::value,
+      detail::builtin_atomic_retry<Policy>>(acc, [=](T old) {
     return ((old >= val) ? 0 : (old + 1));
   });
 }
 
-template <typename T>
+template <typename Policy, typename T>
 RAJA_DEVICE_HIP
-RAJA_INLINE T atomicDec(builtin_atomic, T volatile *acc)
+RAJA_INLINE detail::builtin_atomic_result<Policy, T>
+atomicDec(Policy, T volatile *acc)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a - 1; });
+  return detail::builtin_atomic_fetch_sub<
+      detail::builtin_atomic_order<Policy>::value,
+      detail::builtin_atomic_retry<Policy>>(
+      acc, T(1), detail::builtin_atomic_native<T>{});
 }
 
-template <typename T>
+template <typename Policy, typename T>
 RAJA_DEVICE_HIP
-RAJA_INLINE T atomicDec(builtin_atomic, T volatile *acc, T val)
+RAJA_INLINE detail::builtin_atomic_result<Policy, T>
+atomicDec(Policy, T volatile *acc, T val)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T old) {
+  return detail::builtin_atomic_CAS_oper<
+      detail::builtin_atomic_order<Policy>::value,
+      detail::builtin_atomic_retry<Policy>>(acc, [=](T old) {
     return (((old == 0) | (old > val)) ? val : (old - 1));
   });
 }
 
-template <typename T>
+template <typename Policy, typename T>
 RAJA_DEVICE_HIP
-RAJA_INLINE T atomicAnd(builtin_atomic, T volatile *acc, T value)
+RAJA_INLINE detail::builtin_atomic_result<Policy, T>
+atomicAnd(Policy, T volatile *acc, T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a & value; });
+  return detail::builtin_atomic_fetch_and<
+      detail::builtin_atomic_order<Policy>::value,
+      detail::builtin_atomic_retry<Policy>>(
+      acc, value, detail::builtin_atomic_native<T>{});
 }
 
-template <typename T>
+template <typename Policy, typename T>
 RAJA_DEVICE_HIP
-RAJA_INLINE T atomicOr(builtin_atomic, T volatile *acc, T value)
+RAJA_INLINE detail::builtin_atomic_result<Policy, T>
+atomicOr(Policy, T volatile *acc, T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a | value; });
+  return detail::builtin_atomic_fetch_or<
+      detail::builtin_atomic_order<Policy>::value,
+      detail::builtin_atomic_retry<Policy>>(
+      acc, value, detail::builtin_atomic_native<T>{});
 }
 
-template <typename T>
+template <typename Policy, typename T>
 RAJA_DEVICE_HIP
-RAJA_INLINE T atomicXor(builtin_atomic, T volatile *acc, T value)
+RAJA_INLINE detail::builtin_atomic_result<Policy, T>
+atomicXor(Policy, T volatile *acc, T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a ^ value; });
+  return detail::builtin_atomic_fetch_xor<
+      detail::builtin_atomic_order<Policy>::value,
+      detail::builtin_atomic_retry<Policy>>(
+      acc, value, detail::builtin_atomic_native<T>{});
 }
 
-template <typename T>
+template <typename Policy, typename T>
 RAJA_DEVICE_HIP
-RAJA_INLINE T atomicExchange(builtin_atomic, T volatile *acc, T value)
+RAJA_INLINE detail::builtin_atomic_result<Policy, T>
+atomicExchange(Policy, T volatile *acc, T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T) { return value; });
+  return detail::builtin_atomic_exchange<
+      detail::builtin_atomic_order<Policy>::value,
+      detail::builtin_atomic_retry<Policy>>(
+      acc, value, detail::builtin_atomic_native<T>{});
 }
 
-template <typename T>
+template <typename Policy, typename T>
 RAJA_DEVICE_HIP
-RAJA_INLINE T atomicCAS(builtin_atomic, T volatile *acc, T compare, T value)
+RAJA_INLINE detail::builtin_atomic_result<Policy, T>
+atomicCAS(Policy, T volatile *acc, T compare, T value)
+{
+  return detail::builtin_atomic_CAS<
+      detail::builtin_atomic_order<Policy>::value>(acc, compare, value);
+}
+
+/*!
+ * Min and max of value-location pairs with val and loc members, such as
+ * ValueLoc<double, Index_type>, whose 16 bytes are updated by one CAS.
+ * Like atomicMin, they skip the update when the current value is strictly
+ * better, which is safe to decide from a torn read of val because the pair
+ * only ever improves. The pair they return then comes from one CAS that
+ * writes back what it finds, so it is never torn, but the skip saves the
+ * retry loop rather than the CAS.
+ */
+template <typename Policy, typename T>
+RAJA_INLINE detail::builtin_atomic_result<Policy, T>
+atomicMinLoc(Policy, T volatile *acc, T value)
+{
+  if (acc->val < value.val) {
+    T const seen = *const_cast<T *>(acc);
+    return detail::builtin_atomic_CAS<
+        detail::builtin_atomic_order<Policy>::value>(acc, seen, seen);
+  }
+  return detail::builtin_atomic_CAS_oper_sc<
+      detail::builtin_atomic_order<Policy>::value,
+      detail::builtin_atomic_retry<Policy>>(
+      acc,
+      [=](T a) {
+        return detail::builtin_loc_before<true>(value, a) ? value : a;
+      },
+      [=](T current) {
+        return !detail::builtin_loc_before<true>(value, current);
+      });
+}
+
+template <typename Policy, typename T>
+RAJA_INLINE detail::builtin_atomic_result<Policy, T>
+atomicMaxLoc(Policy, T volatile *acc, T value)
 {
-  return detail::builtin_atomic_CAS(acc, compare, value);
+  if (acc->val > value.val) {
+    T const seen = *const_cast<T *>(acc);
+    return detail::builtin_atomic_CAS<
+        detail::builtin_atomic_order<Policy>::value>(acc, seen, seen);
+  }
+  return detail::builtin_atomic_CAS_oper_sc<
+      detail::builtin_atomic_order<Policy>::value,
+      detail::builtin_atomic_retry<Policy>>(
+      acc,
+      [=](T a) {
+        return detail::builtin_loc_before<false>(value, a) ? value : a;
+      },
+      [=](T current) {
+        return !detail::builtin_loc_before<false>(value, current);
+      });
 }
 
 
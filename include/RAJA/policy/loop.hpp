@@ -25,5 +25,6 @@
 #include "RAJA/policy/loop/kernel.hpp"
 #include "RAJA/policy/loop/policy.hpp"
 #include "RAJA/policy/loop/scan.hpp"
+#include "RAJA/policy/loop/sort.hpp"
 
 #endif  // closing endif for header file include guard
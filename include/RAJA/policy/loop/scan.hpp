@@ -28,7 +28,10 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/pattern/detail/scan.hpp"
+
 #include "RAJA/policy/loop/policy.hpp"
+#include "RAJA/policy/simd/policy.hpp"
 
 namespace RAJA
 {
@@ -36,23 +39,26 @@ namespace impl
 {
 namespace scan
 {
+
+// loop_exec and simd_exec scan integer sums, minima and maxima over
+// contiguous ranges in registers where the compiler supports vector
+// extensions; other scans use a scalar loop.  Segmented scans with
+// simd_exec run the sequential implementation.
+
 /*!
         \brief explicit inclusive inplace scan given range, function, and
    initial value
 */
 template <typename ExecPolicy, typename Iter, typename BinFn>
-concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> inclusive_inplace(
-    const ExecPolicy &,
-    Iter begin,
-    Iter end,
-    BinFn f)
+concepts::enable_if<
+    concepts::any_of<type_traits::is_loop_policy<ExecPolicy>,
+                     type_traits::is_simd_exec<ExecPolicy>>>
+inclusive_inplace(const ExecPolicy &, Iter begin, Iter end, BinFn f)
 {
-  auto agg = *begin;
-
-  for (Iter i = ++begin; i != end; ++i) {
-    agg = f(*i, agg);
-    *i = agg;
-  }
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  const Index_type n = end - begin;
+  if (n <= 0) return;
+  ::RAJA::detail::scan_block<false>(begin, begin, 1, n, f, Value(*begin));
 }
 
 /*!
@@ -60,21 +66,13 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> inclusive_inplace(
    initial value
 */
 template <typename ExecPolicy, typename Iter, typename BinFn, typename T>
-concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> exclusive_inplace(
-    const ExecPolicy &,
-    Iter begin,
-    Iter end,
-    BinFn f,
-    T v)
+concepts::enable_if<
+    concepts::any_of<type_traits::is_loop_policy<ExecPolicy>,
+                     type_traits::is_simd_exec<ExecPolicy>>>
+exclusive_inplace(const ExecPolicy &, Iter begin, Iter end, BinFn f, T v)
 {
-  const int n = end - begin;
-  decltype(*begin) agg = v;
-
-  for (int i = 0; i < n; ++i) {
-    auto t = *(begin + i);
-    *(begin + i) = agg;
-    agg = f(agg, t);
-  }
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  ::RAJA::detail::scan_block<true>(begin, begin, 0, end - begin, f, Value(v));
 }
 
 /*!
@@ -82,20 +80,21 @@ concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> exclusive_inplace(
    initial value
 */
 template <typename ExecPolicy, typename Iter, typename OutIter, typename BinFn>
-concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> inclusive(
-    const ExecPolicy &,
-    const Iter begin,
-    const Iter end,
-    OutIter out,
-    BinFn f)
+concepts::enable_if<
+    concepts::any_of<type_traits::is_loop_policy<ExecPolicy>,
+                     type_traits::is_simd_exec<ExecPolicy>>>
+inclusive(const ExecPolicy &,
+          const Iter begin,
+          const Iter end,
+          OutIter out,
+          BinFn f)
 {
-  auto agg = *begin;
-  *out++ = agg;
-
-  for (Iter i = begin + 1; i != end; ++i) {
-    agg = f(agg, *i);
-    *out++ = agg;
-  }
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const Index_type n = end - begin;
+  if (n <= 0) return;
+  const Value first = *begin;
+  *out = first;
+  ::RAJA::detail::scan_block<false>(begin, out, 1, n, f, first);
 }
 
 /*!
@@ -107,22 +106,70 @@ template <typename ExecPolicy,
           typename OutIter,
           typename BinFn,
           typename T>
-concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> exclusive(
-    const ExecPolicy &,
-    const Iter begin,
-    const Iter end,
-    OutIter out,
-    BinFn f,
-    T v)
+concepts::enable_if<
+    concepts::any_of<type_traits::is_loop_policy<ExecPolicy>,
+                     type_traits::is_simd_exec<ExecPolicy>>>
+exclusive(const ExecPolicy &,
+          const Iter begin,
+          const Iter end,
+          OutIter out,
+          BinFn f,
+          T v)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  ::RAJA::detail::scan_block<true>(begin, out, 0, end - begin, f, Value(v));
+}
+
+/*!
+        \brief explicit inclusive segmented scan given input range, segment
+   heads, output, and function
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Heads,
+          typename OutIter,
+          typename BinFn>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+inclusive_segmented(const ExecPolicy &,
+                    Iter begin,
+                    Index_type first,
+                    Index_type last,
+                    Heads heads,
+                    OutIter out,
+                    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  using Partial = ::RAJA::detail::SegmentPartial<Value>;
+  const Value init = BinFn::identity();
+  ::RAJA::detail::segmented_scan_block<false>(
+      begin, out, first, last, heads.at(first), f, init, Partial{false, init});
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, segment
+   heads, output, function, and initial value of each segment
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Heads,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>>
+exclusive_segmented(const ExecPolicy &,
+                    Iter begin,
+                    Index_type first,
+                    Index_type last,
+                    Heads heads,
+                    OutIter out,
+                    BinFn f,
+                    T v)
 {
-  decltype(*begin) agg = v;
-  OutIter o = out;
-  *o++ = v;
-
-  for (Iter i = begin; i != end - 1; ++i, ++o) {
-    agg = f(*i, agg);
-    *o = agg;
-  }
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  using Partial = ::RAJA::detail::SegmentPartial<Value>;
+  const Value init = v;
+  ::RAJA::detail::segmented_scan_block<true>(
+      begin, out, first, last, heads.at(first), f, init, Partial{false, init});
 }
 
 }  // namespace scan
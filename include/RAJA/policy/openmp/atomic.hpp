@@ -36,6 +36,7 @@ namespace RAJA
 
 // For MS Visual C, just default to builtin_atomic for everything
 using omp_atomic = builtin_atomic;
+using omp_atomic_relaxed = builtin_atomic_relaxed;
 
 
 #else  // not defined RAJA_COMPILER_MSVC
@@ -208,6 +209,209 @@ RAJA_INLINE T atomicCAS(omp_atomic, T volatile *acc, T compare, T value)
   return RAJA::atomicCAS(builtin_atomic{}, acc, compare, value);
 }
 
+template <typename T>
+RAJA_INLINE T atomicMinLoc(omp_atomic, T volatile *acc, T value)
+{
+  // OpenMP atomics don't cover value-location pairs so use builtin atomics
+  return RAJA::atomicMinLoc(builtin_atomic{}, acc, value);
+}
+
+template <typename T>
+RAJA_INLINE T atomicMaxLoc(omp_atomic, T volatile *acc, T value)
+{
+  // OpenMP atomics don't cover value-location pairs so use builtin atomics
+  return RAJA::atomicMaxLoc(builtin_atomic{}, acc, value);
+}
+
+
+/*!
+ * omp_atomic_relaxed performs the operations of omp_atomic with the relaxed
+ * memory order clause of OpenMP 5.0, which orders no other memory accesses.
+ * Where the clause is not supported it is builtin_atomic_relaxed.
+ */
+#if _OPENMP >= 201811 || (defined(RAJA_COMPILER_GNU) && __GNUC__ >= 10)
+
+struct omp_atomic_relaxed {
+};
+
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicAdd(omp_atomic_relaxed, T volatile *acc, T value)
+{
+  T ret;
+#pragma omp atomic capture relaxed
+  {
+    ret = *acc;  // capture old for return value
+    *acc += value;
+  }
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicSub(omp_atomic_relaxed, T volatile *acc, T value)
+{
+  T ret;
+#pragma omp atomic capture relaxed
+  {
+    ret = *acc;  // capture old for return value
+    *acc -= value;
+  }
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicInc(omp_atomic_relaxed, T volatile *acc)
+{
+  T ret;
+#pragma omp atomic capture relaxed
+  {
+    ret = *acc;  // capture old for return value
+    *acc += 1;
+  }
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicDec(omp_atomic_relaxed, T volatile *acc)
+{
+  T ret;
+#pragma omp atomic capture relaxed
+  {
+    ret = *acc;  // capture old for return value
+    *acc -= 1;
+  }
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicAnd(omp_atomic_relaxed, T volatile *acc, T value)
+{
+  T ret;
+#pragma omp atomic capture relaxed
+  {
+    ret = *acc;  // capture old for return value
+    *acc &= value;
+  }
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicOr(omp_atomic_relaxed, T volatile *acc, T value)
+{
+  T ret;
+#pragma omp atomic capture relaxed
+  {
+    ret = *acc;  // capture old for return value
+    *acc |= value;
+  }
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicXor(omp_atomic_relaxed, T volatile *acc, T value)
+{
+  T ret;
+#pragma omp atomic capture relaxed
+  {
+    ret = *acc;  // capture old for return value
+    *acc ^= value;
+  }
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicExchange(omp_atomic_relaxed, T volatile *acc, T value)
+{
+  T ret;
+#pragma omp atomic capture relaxed
+  {
+    ret = *acc;  // capture old for return value
+    *acc = value;
+  }
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicMin(omp_atomic_relaxed, T volatile *acc, T value)
+{
+  // OpenMP doesn't define atomic trinary operators so use builtin atomics
+  return RAJA::atomicMin(builtin_atomic_relaxed{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicMax(omp_atomic_relaxed, T volatile *acc, T value)
+{
+  // OpenMP doesn't define atomic trinary operators so use builtin atomics
+  return RAJA::atomicMax(builtin_atomic_relaxed{}, acc, value);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicInc(omp_atomic_relaxed, T volatile *acc, T val)
+{
+  // OpenMP doesn't define atomic trinary operators so use builtin atomics
+  return RAJA::atomicInc(builtin_atomic_relaxed{}, acc, val);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicDec(omp_atomic_relaxed, T volatile *acc, T val)
+{
+  // OpenMP doesn't define atomic trinary operators so use builtin atomics
+  return RAJA::atomicDec(builtin_atomic_relaxed{}, acc, val);
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicCAS(omp_atomic_relaxed, T volatile *acc, T compare, T value)
+{
+  // OpenMP doesn't define atomic trinary operators so use builtin atomics
+  return RAJA::atomicCAS(builtin_atomic_relaxed{}, acc, compare, value);
+}
+
+template <typename T>
+RAJA_INLINE T atomicMinLoc(omp_atomic_relaxed, T volatile *acc, T value)
+{
+  // OpenMP atomics don't cover value-location pairs so use builtin atomics
+  return RAJA::atomicMinLoc(builtin_atomic_relaxed{}, acc, value);
+}
+
+template <typename T>
+RAJA_INLINE T atomicMaxLoc(omp_atomic_relaxed, T volatile *acc, T value)
+{
+  // OpenMP atomics don't cover value-location pairs so use builtin atomics
+  return RAJA::atomicMaxLoc(builtin_atomic_relaxed{}, acc, value);
+}
+
+#else  // no OpenMP relaxed atomics
+
+using omp_atomic_relaxed = builtin_atomic_relaxed;
+
+#endif  // OpenMP relaxed atomics
+
 #endif  // not defined RAJA_COMPILER_MSVC
 
 
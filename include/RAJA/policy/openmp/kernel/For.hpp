@@ -0,0 +1,148 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for OpenMP statement::For executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_For_HPP
+#define RAJA_policy_openmp_kernel_For_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include "RAJA/pattern/kernel/For.hpp"
+#include "RAJA/pattern/kernel/Reduce.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/policy/openmp/forall.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/region.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+
+/*!
+ * Executor for a statement::For using an omp_parallel_exec based policy.
+ *
+ * Without any enclosed statement::Reduce<omp_reduce> this is the generic
+ * forall_impl path.  Otherwise each thread runs its share of the iterations
+ * on a private copy of the loop data, folding the reduced Params into its
+ * own partial results.  The partial results are combined once per thread
+ * when the loop finishes, after which the enclosed statements of each
+ * Reduce run once with the reduced value.
+ */
+template <typename ExecPolicy,
+          typename InnerPolicy,
+          camp::idx_t ArgumentId,
+          typename... EnclosedStmts>
+struct OmpParallelForExecutor {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using data_t = camp::decay<Data>;
+    exec_impl<data_t>(
+        data,
+        enclosed_reduce_statements_t<omp_reduce,
+                                     camp::list<EnclosedStmts...>>{});
+  }
+
+  template <typename data_t>
+  static RAJA_INLINE void exec_impl(data_t &data, camp::list<>)
+  {
+    ForWrapper<ArgumentId, data_t, EnclosedStmts...> for_wrapper(data);
+
+    auto len = segment_length<ArgumentId>(data);
+    using len_t = decltype(len);
+
+    forall_impl(ExecPolicy{}, TypedRangeSegment<len_t>(0, len), for_wrapper);
+  }
+
+  template <typename data_t, typename... ReduceStmts>
+  static RAJA_INLINE void exec_impl(data_t &data,
+                                    camp::list<ReduceStmts...>)
+  {
+    using accumulators_t =
+        ReduceAccumulatorList<data_t, camp::list<ReduceStmts...>>;
+
+    auto len = segment_length<ArgumentId>(data);
+    using len_t = decltype(len);
+
+    accumulators_t result(data);
+
+    RAJA::region<RAJA::omp_parallel_region>([&]() {
+      accumulators_t partial;
+
+      data_t private_data(data);
+      partial.reset(private_data);
+
+      ForWrapper<ArgumentId, data_t, EnclosedStmts...> for_wrapper(
+          private_data);
+
+      partial.push();
+      forall_impl(InnerPolicy{}, TypedRangeSegment<len_t>(0, len), for_wrapper);
+      partial.pop();
+
+#pragma omp critical(ompKernelReduceCritical)
+      result.combine(partial);
+    });
+
+    result.finish(data);
+  }
+};
+
+
+template <camp::idx_t ArgumentId, typename InnerPolicy, typename... EnclosedStmts>
+struct StatementExecutor<statement::For<ArgumentId,
+                                        omp_parallel_exec<InnerPolicy>,
+                                        EnclosedStmts...>>
+    : OmpParallelForExecutor<omp_parallel_exec<InnerPolicy>,
+                             InnerPolicy,
+                             ArgumentId,
+                             EnclosedStmts...> {
+};
+
+template <camp::idx_t ArgumentId, typename... EnclosedStmts>
+struct StatementExecutor<
+    statement::For<ArgumentId, omp_parallel_for_exec, EnclosedStmts...>>
+    : OmpParallelForExecutor<omp_parallel_for_exec,
+                             omp_for_exec,
+                             ArgumentId,
+                             EnclosedStmts...> {
+};
+
+template <camp::idx_t ArgumentId,
+          unsigned int ChunkSize,
+          typename... EnclosedStmts>
+struct StatementExecutor<statement::For<ArgumentId,
+                                        policy::omp::omp_parallel_for_static<ChunkSize>,
+                                        EnclosedStmts...>>
+    : OmpParallelForExecutor<policy::omp::omp_parallel_for_static<ChunkSize>,
+                             omp_for_static<ChunkSize>,
+                             ArgumentId,
+                             EnclosedStmts...> {
+};
+
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
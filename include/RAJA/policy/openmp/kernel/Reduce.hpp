@@ -0,0 +1,58 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for OpenMP statement::Reduce executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_Reduce_HPP
+#define RAJA_policy_openmp_kernel_Reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include "RAJA/pattern/kernel/Reduce.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+//
+// Executor that handles reductions across the threads of the innermost
+// enclosing omp parallel statement::For
+//
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts>
+struct StatementExecutor<
+    statement::Reduce<omp_reduce, ReduceOperator, ParamId, EnclosedStmts...>>
+    : HostReduceStatementExecutor<statement::
+                                      Reduce<omp_reduce,
+                                             ReduceOperator,
+                                             ParamId,
+                                             EnclosedStmts...>> {
+};
+
+
+}  // namespace internal
+
+}  // end namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif /* RAJA_policy_openmp_kernel_Reduce_HPP */
@@ -26,10 +26,10 @@
 #if defined(RAJA_ENABLE_OPENMP)
 
 #include <memory>
-#include <vector>
 
 #include <omp.h>
 
+#include "RAJA/util/ReducerPool.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
@@ -75,13 +75,52 @@ RAJA_DECLARE_ALL_REDUCERS(omp_reduce, detail::ReduceOMP)
 
 namespace detail
 {
+/*!
+ * \brief Pooled per-thread storage for ordered OpenMP reductions.
+ *
+ * Each acquisition bumps the epoch, slots written under an older epoch are
+ * treated as holding the identity, so reusing a slab needs no clearing pass.
+ */
+template <typename T>
+struct ReduceOMPOrderedSlab {
+  struct Slot {
+    T val;
+    size_t epoch;
+  };
+
+  std::unique_ptr<Slot[]> slots;
+  int size = 0;
+  size_t epoch = 0;
+  T identity;
+
+  void prepare(int num_threads, T identity_)
+  {
+    if (size < num_threads) {
+      slots.reset(new Slot[num_threads]());
+      size = num_threads;
+    }
+    ++epoch;
+    identity = identity_;
+  }
+
+  T& at(int thread_id)
+  {
+    Slot& slot = slots[thread_id];
+    if (slot.epoch != epoch) {
+      slot.val = identity;
+      slot.epoch = epoch;
+    }
+    return slot.val;
+  }
+};
+
 template <typename T, typename Reduce>
 class ReduceOMPOrdered
     : public reduce::detail::
           BaseCombinable<T, Reduce, ReduceOMPOrdered<T, Reduce>>
 {
   using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMPOrdered>;
-  std::shared_ptr<std::vector<T>> data;
+  PooledStorage<ReduceOMPOrderedSlab<T>> data;
 
 public:
   ReduceOMPOrdered() { reset(T(), T()); }
@@ -95,26 +134,25 @@ public:
   void reset(T init_val, T identity_)
   {
     Base::reset(init_val, identity_);
-    data = std::shared_ptr<std::vector<T>>(
-        std::make_shared<std::vector<T>>(omp_get_max_threads(), identity_));
+    data->prepare(omp_get_max_threads(), identity_);
   }
 
   ~ReduceOMPOrdered()
   {
-    Reduce{}((*data)[omp_get_thread_num()], Base::my_data);
+    Reduce{}(data->at(omp_get_thread_num()), Base::my_data);
     Base::my_data = Base::identity;
   }
 
   T get_combined() const
   {
     if (Base::my_data != Base::identity) {
-      Reduce{}((*data)[omp_get_thread_num()], Base::my_data);
+      Reduce{}(data->at(omp_get_thread_num()), Base::my_data);
       Base::my_data = Base::identity;
     }
 
     T res = Base::identity;
-    for (size_t i = 0; i < data->size(); ++i) {
-      Reduce{}(res, (*data)[i]);
+    for (int i = 0; i < data->size; ++i) {
+      Reduce{}(res, data->at(i));
     }
     return res;
   }
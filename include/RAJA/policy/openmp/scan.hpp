@@ -28,8 +28,11 @@
 
 #include <omp.h>
 
+#include "RAJA/internal/Iterators.hpp"
+#include "RAJA/pattern/detail/scan.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
-#include "RAJA/policy/loop/scan.hpp"
+#include "RAJA/util/ReducerPool.hpp"
+#include "RAJA/util/types.hpp"
 
 namespace RAJA
 {
@@ -39,11 +42,230 @@ namespace scan
 {
 
 RAJA_INLINE
-int firstIndex(int n, int p, int pid)
+Index_type firstIndex(Index_type n, int p, int pid)
 {
-  return (static_cast<size_t>(n) * pid) / p;
+  return (n / p) * pid + (n % p) * pid / p;
+}
+
+namespace detail
+{
+
+//! per-thread partial results of a scan, reused across calls
+template <typename Value>
+struct ScanScratch {
+  ::std::vector<Value> sums;
+};
+
+template <typename Value, typename Iter, typename BinFn>
+RAJA_INLINE Value reduce_block(Iter in, Index_type i0, Index_type i1, BinFn f)
+{
+  Value agg = *(in + i0);
+  for (Index_type i = i0 + 1; i < i1; ++i) {
+    agg = f(agg, *(in + i));
+  }
+  return agg;
 }
 
+/*!
+ * Reduce-then-scan: each thread reduces its block of the input, the block
+ * totals are scanned into the starting value of each block, and each
+ * thread then scans its block straight into the output.  The output is
+ * written once and may alias the input.  Blocks are combined strictly
+ * left to right, so f need not be commutative.
+ */
+template <bool Exclusive,
+          typename Value,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+void omp_scan(Iter begin, Iter end, OutIter out, BinFn f, Value init)
+{
+  const Index_type n = end - begin;
+  if (n <= 0) return;
+
+  const int p0 =
+      static_cast<int>(::std::min<Index_type>(n, omp_get_max_threads()));
+  if (p0 == 1) {
+    ::RAJA::detail::scan_block<Exclusive>(begin, out, 0, n, f, init);
+    return;
+  }
+
+  ::RAJA::detail::PooledStorage<ScanScratch<Value>> scratch;
+  ::std::vector<Value>& sums = scratch->sums;
+  if (sums.size() < static_cast<size_t>(p0)) {
+    sums.resize(p0, init);
+  }
+  Value* const partial = sums.data();
+
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const Index_type i0 = firstIndex(n, p, pid);
+    const Index_type i1 = firstIndex(n, p, pid + 1);
+
+    if (i0 < i1) {
+      partial[pid] = reduce_block<Value>(begin, i0, i1, f);
+    }
+
+#pragma omp barrier
+#pragma omp single
+    {
+      Value agg = init;
+      for (int t = 0; t < p; ++t) {
+        const Value sum = partial[t];
+        partial[t] = agg;
+        if (firstIndex(n, p, t) < firstIndex(n, p, t + 1)) {
+          agg = f(agg, sum);
+        }
+      }
+    }
+
+    ::RAJA::detail::scan_block<Exclusive>(
+        begin, out, i0, i1, f, partial[pid]);
+  }
+}
+
+/*!
+ * Scan-then-propagate, for inputs that must be read only once, such as
+ * transform iterators: each thread scans its block of the input straight
+ * into the output, the block totals are scanned into the starting value of
+ * each block, and each thread then combines that value into its block of
+ * the output.  The output must not alias the input.
+ */
+template <bool Exclusive,
+          typename Value,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+void omp_scan_propagate(Iter begin, Iter end, OutIter out, BinFn f, Value init)
+{
+  const Index_type n = end - begin;
+  if (n <= 0) return;
+
+  const int p0 =
+      static_cast<int>(::std::min<Index_type>(n, omp_get_max_threads()));
+  if (p0 == 1) {
+    ::RAJA::detail::scan_block<Exclusive>(begin, out, 0, n, f, init);
+    return;
+  }
+
+  ::RAJA::detail::PooledStorage<ScanScratch<Value>> scratch;
+  ::std::vector<Value>& sums = scratch->sums;
+  if (sums.size() < static_cast<size_t>(p0)) {
+    sums.resize(p0, init);
+  }
+  Value* const partial = sums.data();
+
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const Index_type i0 = firstIndex(n, p, pid);
+    const Index_type i1 = firstIndex(n, p, pid + 1);
+
+    if (i0 < i1) {
+      partial[pid] = ::RAJA::detail::scan_block<Exclusive>(
+          begin, out, i0, i1, f, Value(BinFn::identity()));
+    }
+
+#pragma omp barrier
+#pragma omp single
+    {
+      Value agg = init;
+      for (int t = 0; t < p; ++t) {
+        const Value sum = partial[t];
+        partial[t] = agg;
+        if (firstIndex(n, p, t) < firstIndex(n, p, t + 1)) {
+          agg = f(agg, sum);
+        }
+      }
+    }
+
+    if (Exclusive || pid > 0) {
+      const Value prefix = partial[pid];
+      for (Index_type i = i0; i < i1; ++i) {
+        *(out + i) = f(prefix, *(out + i));
+      }
+    }
+  }
+}
+
+/*!
+ * Segmented reduce-then-scan: as omp_scan, with the block totals replaced
+ * by SegmentPartials so segments of any length and number are scanned in
+ * the same two passes.
+ */
+template <bool Exclusive,
+          typename Value,
+          typename Iter,
+          typename Heads,
+          typename OutIter,
+          typename BinFn>
+void omp_segmented_scan(Iter begin,
+                        Index_type first,
+                        Index_type last,
+                        Heads heads,
+                        OutIter out,
+                        BinFn f,
+                        Value init)
+{
+  using Partial = ::RAJA::detail::SegmentPartial<Value>;
+  using PartialOp = ::RAJA::detail::segmented_op<Value, BinFn>;
+
+  const Index_type n = last - first;
+  if (n <= 0) return;
+
+  const int p0 =
+      static_cast<int>(::std::min<Index_type>(n, omp_get_max_threads()));
+  if (p0 == 1) {
+    ::RAJA::detail::segmented_scan_block<Exclusive>(begin,
+                                                    out,
+                                                    first,
+                                                    last,
+                                                    heads.at(first),
+                                                    f,
+                                                    init,
+                                                    PartialOp::identity());
+    return;
+  }
+
+  ::RAJA::detail::PooledStorage<ScanScratch<Partial>> scratch;
+  ::std::vector<Partial>& sums = scratch->sums;
+  if (sums.size() < static_cast<size_t>(p0)) {
+    sums.resize(p0, PartialOp::identity());
+  }
+  Partial* const partial = sums.data();
+
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const Index_type i0 = first + firstIndex(n, p, pid);
+    const Index_type i1 = first + firstIndex(n, p, pid + 1);
+
+    partial[pid] = ::RAJA::detail::segmented_reduce_block(
+        begin, i0, i1, heads.at(i0), f, init, PartialOp::identity());
+
+#pragma omp barrier
+#pragma omp single
+    {
+      const PartialOp op{f};
+      Partial agg = PartialOp::identity();
+      for (int t = 0; t < p; ++t) {
+        const Partial sum = partial[t];
+        partial[t] = agg;
+        agg = op(agg, sum);
+      }
+    }
+
+    ::RAJA::detail::segmented_scan_block<Exclusive>(
+        begin, out, i0, i1, heads.at(i0), f, init, partial[pid]);
+  }
+}
+
+}  // namespace detail
+
 /*!
         \brief explicit inclusive inplace scan given range, function, and
    initial value
@@ -56,25 +278,7 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive_inplace(
     BinFn f)
 {
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const int n = end - begin;
-  const int p0 = std::min(n, omp_get_max_threads());
-  ::std::vector<Value> sums(p0, Value());
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const int i0 = firstIndex(n, p, pid);
-    const int i1 = firstIndex(n, p, pid + 1);
-    inclusive_inplace(::RAJA::loop_exec{}, begin + i0, begin + i1, f);
-    sums[pid] = *(begin + i1 - 1);
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(
-        ::RAJA::loop_exec{}, sums.data(), sums.data() + p, f, BinFn::identity());
-    for (int i = i0; i < i1; ++i) {
-      *(begin + i) = f(*(begin + i), sums[pid]);
-    }
-  }
+  detail::omp_scan<false, Value>(begin, end, begin, f, BinFn::identity());
 }
 
 /*!
@@ -90,27 +294,7 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_inplace(
     ValueT v)
 {
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const int n = end - begin;
-  const int p0 = std::min(n, omp_get_max_threads());
-  ::std::vector<Value> sums(p0, v);
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const int i0 = firstIndex(n, p, pid);
-    const int i1 = firstIndex(n, p, pid + 1);
-    const Value init = ((pid == 0) ? v : *(begin + i0 - 1));
-#pragma omp barrier
-    exclusive_inplace(loop_exec{}, begin + i0, begin + i1, f, init);
-    sums[pid] = *(begin + i1 - 1);
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(
-        loop_exec{}, sums.data(), sums.data() + p, f, BinFn::identity());
-    for (int i = i0; i < i1; ++i) {
-      *(begin + i) = f(*(begin + i), sums[pid]);
-    }
-  }
+  detail::omp_scan<true, Value>(begin, end, begin, f, Value(v));
 }
 
 /*!
@@ -119,14 +303,14 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_inplace(
 */
 template <typename Policy, typename Iter, typename OutIter, typename BinFn>
 concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive(
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f)
 {
-  ::std::copy(begin, end, out);
-  inclusive_inplace(exec, out, out + (end - begin), f);
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  detail::omp_scan<false, Value>(begin, end, out, f, BinFn::identity());
 }
 
 /*!
@@ -139,15 +323,117 @@ template <typename Policy,
           typename BinFn,
           typename ValueT>
 concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive(
-    const Policy& exec,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  detail::omp_scan<true, Value>(begin, end, out, f, Value(v));
+}
+
+/*!
+        \brief explicit inclusive scan of unop applied to each input value,
+   calling unop at most once per value
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename UnaryOp,
+          typename BinFn>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> transform_inclusive(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    UnaryOp unop,
+    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  detail::omp_scan_propagate<false, Value>(
+      Iterators::make_transform_iterator(begin, unop),
+      Iterators::make_transform_iterator(end, unop),
+      out,
+      f,
+      Value(BinFn::identity()));
+}
+
+/*!
+        \brief explicit exclusive scan of unop applied to each input value,
+   calling unop at most once per value
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename UnaryOp,
+          typename BinFn,
+          typename ValueT>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> transform_exclusive(
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
+    UnaryOp unop,
+    BinFn f,
+    ValueT v)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  detail::omp_scan_propagate<true, Value>(
+      Iterators::make_transform_iterator(begin, unop),
+      Iterators::make_transform_iterator(end, unop),
+      out,
+      f,
+      Value(v));
+}
+
+/*!
+        \brief explicit inclusive segmented scan given input range, segment
+   heads, output, and function
+*/
+template <typename Policy,
+          typename Iter,
+          typename Heads,
+          typename OutIter,
+          typename BinFn>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive_segmented(
+    const Policy&,
+    Iter begin,
+    Index_type first,
+    Index_type last,
+    Heads heads,
+    OutIter out,
+    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  detail::omp_segmented_scan<false, Value>(
+      begin, first, last, heads, out, f, BinFn::identity());
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, segment
+   heads, output, function, and initial value of each segment
+*/
+template <typename Policy,
+          typename Iter,
+          typename Heads,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_segmented(
+    const Policy&,
+    Iter begin,
+    Index_type first,
+    Index_type last,
+    Heads heads,
+    OutIter out,
     BinFn f,
     ValueT v)
 {
-  ::std::copy(begin, end, out);
-  exclusive_inplace(exec, out, out + (end - begin), f, v);
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  detail::omp_segmented_scan<true, Value>(
+      begin, first, last, heads, out, f, Value(v));
 }
 
 }  // namespace scan
@@ -0,0 +1,138 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_openmp_HPP
+#define RAJA_sort_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/pattern/detail/sort.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+
+/*!
+ * Merge sort: each thread sorts one block of the input, then the sorted
+ * blocks are merged pairwise, alternating between the input and a buffer.
+ * In every merge pass each thread writes an equal share of the output,
+ * found by binary searches on the runs being merged, so all threads stay
+ * busy as the runs get longer and fewer.
+ */
+template <bool Stable, typename Iter, typename Compare>
+void omp_merge_sort(Iter begin, Iter end, Compare comp)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+
+  const Index_type n = end - begin;
+  const int p0 = static_cast<int>(::std::min<Index_type>(
+      n / ::RAJA::detail::sort_serial_threshold + 1, omp_get_max_threads()));
+  if (p0 <= 1) {
+    if (Stable) {
+      ::std::stable_sort(begin, end, comp);
+    } else {
+      ::std::sort(begin, end, comp);
+    }
+    return;
+  }
+
+  ::std::vector<Value> buffer(n);
+  Value* const tmp = buffer.data();
+
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const ::RAJA::detail::MergeRuns runs{n, p};
+    const Index_type o0 = runs.leaf_begin(pid);
+    const Index_type o1 = runs.leaf_begin(pid + 1);
+
+    if (Stable) {
+      ::std::stable_sort(begin + o0, begin + o1, comp);
+    } else {
+      ::std::sort(begin + o0, begin + o1, comp);
+    }
+
+    bool in_buffer = false;
+    for (Index_type width = 1; width < p; width *= 2) {
+#pragma omp barrier
+      if (in_buffer) {
+        ::RAJA::detail::merge_pass_part(tmp, begin, runs, width, o0, o1, comp);
+      } else {
+        ::RAJA::detail::merge_pass_part(begin, tmp, runs, width, o0, o1, comp);
+      }
+      in_buffer = !in_buffer;
+    }
+
+    // the last pass still reads the input, so wait before overwriting it
+    if (in_buffer) {
+#pragma omp barrier
+      ::std::move(tmp + o0, tmp + o1, begin + o0);
+    }
+  }
+}
+
+}  // namespace detail
+
+/*!
+        \brief sort given range and comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>> unstable(
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::omp_merge_sort<false>(begin, end, comp);
+}
+
+/*!
+        \brief stable sort given range and comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>> stable(
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::omp_merge_sort<true>(begin, end, comp);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -162,6 +162,32 @@ RAJA_INLINE T atomicCAS(seq_atomic, T volatile *acc, T compare, T value)
   return ret;
 }
 
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicMinLoc(seq_atomic, T volatile *acc, T value)
+{
+  T *target = const_cast<T *>(acc);
+  T ret = *target;
+  if (value.val < ret.val || (!(ret.val < value.val) && value.loc < ret.loc)) {
+    *target = value;
+  }
+  return ret;
+}
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_HOST_DEVICE
+RAJA_INLINE T atomicMaxLoc(seq_atomic, T volatile *acc, T value)
+{
+  T *target = const_cast<T *>(acc);
+  T ret = *target;
+  if (ret.val < value.val || (!(value.val < ret.val) && value.loc < ret.loc)) {
+    *target = value;
+  }
+  return ret;
+}
+
 
 }  // namespace RAJA
 
@@ -28,7 +28,10 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/pattern/detail/scan.hpp"
+
 #include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/policy/simd/policy.hpp"
 
 namespace RAJA
 {
@@ -41,7 +44,8 @@ namespace scan
    initial value
 */
 template <typename ExecPolicy, typename Iter, typename BinFn>
-concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>,
+                    concepts::negate<type_traits::is_simd_exec<ExecPolicy>>>
 inclusive_inplace(const ExecPolicy &, Iter begin, Iter end, BinFn f)
 {
   auto agg = *begin;
@@ -58,11 +62,12 @@ inclusive_inplace(const ExecPolicy &, Iter begin, Iter end, BinFn f)
    initial value
 */
 template <typename ExecPolicy, typename Iter, typename BinFn, typename T>
-concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>,
+                    concepts::negate<type_traits::is_simd_exec<ExecPolicy>>>
 exclusive_inplace(const ExecPolicy &, Iter begin, Iter end, BinFn f, T v)
 {
   const int n = end - begin;
-  decltype(*begin) agg = v;
+  typename ::std::iterator_traits<Iter>::value_type agg = v;
 
   RAJA_NO_SIMD
   for (int i = 0; i < n; ++i) {
@@ -77,12 +82,13 @@ exclusive_inplace(const ExecPolicy &, Iter begin, Iter end, BinFn f, T v)
    initial value
 */
 template <typename ExecPolicy, typename Iter, typename OutIter, typename BinFn>
-concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> inclusive(
-    const ExecPolicy &,
-    const Iter begin,
-    const Iter end,
-    OutIter out,
-    BinFn f)
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>,
+                    concepts::negate<type_traits::is_simd_exec<ExecPolicy>>>
+inclusive(const ExecPolicy &,
+          const Iter begin,
+          const Iter end,
+          OutIter out,
+          BinFn f)
 {
   auto agg = *begin;
   *out++ = agg;
@@ -103,15 +109,16 @@ template <typename ExecPolicy,
           typename OutIter,
           typename BinFn,
           typename T>
-concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> exclusive(
-    const ExecPolicy &,
-    const Iter begin,
-    const Iter end,
-    OutIter out,
-    BinFn f,
-    T v)
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>,
+                    concepts::negate<type_traits::is_simd_exec<ExecPolicy>>>
+exclusive(const ExecPolicy &,
+          const Iter begin,
+          const Iter end,
+          OutIter out,
+          BinFn f,
+          T v)
 {
-  decltype(*begin) agg = v;
+  typename ::std::iterator_traits<OutIter>::value_type agg = v;
   OutIter o = out;
   *o++ = v;
 
@@ -122,6 +129,58 @@ concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> exclusive(
   }
 }
 
+/*!
+        \brief explicit inclusive segmented scan given input range, segment
+   heads, output, and function
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Heads,
+          typename OutIter,
+          typename BinFn>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+inclusive_segmented(const ExecPolicy &,
+                    Iter begin,
+                    Index_type first,
+                    Index_type last,
+                    Heads heads,
+                    OutIter out,
+                    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  using Partial = ::RAJA::detail::SegmentPartial<Value>;
+  const Value init = BinFn::identity();
+  ::RAJA::detail::segmented_scan_block<false>(
+      begin, out, first, last, heads.at(first), f, init, Partial{false, init});
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, segment
+   heads, output, function, and initial value of each segment
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Heads,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+exclusive_segmented(const ExecPolicy &,
+                    Iter begin,
+                    Index_type first,
+                    Index_type last,
+                    Heads heads,
+                    OutIter out,
+                    BinFn f,
+                    T v)
+{
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  using Partial = ::RAJA::detail::SegmentPartial<Value>;
+  const Value init = v;
+  ::RAJA::detail::segmented_scan_block<true>(
+      begin, out, first, last, heads.at(first), f, init, Partial{false, init});
+}
+
 }  // namespace scan
 
 }  // namespace impl
@@ -35,6 +35,8 @@
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/pattern/detail/forall_param.hpp"
+
 #include "RAJA/policy/simd/policy.hpp"
 
 namespace RAJA
@@ -59,6 +61,25 @@ RAJA_INLINE void forall_impl(const simd_exec &,
   }
 }
 
+//! number of independent accumulators per reduction parameter
+constexpr camp::idx_t reduce_lanes = 8;
+
+/*!
+ * forall_param loop bodies update one accumulator per SIMD lane so that the
+ * reductions do not serialize the vectorized loop.
+ */
+template <typename Iterable, typename ParamTuple, typename LoopBody>
+RAJA_INLINE void forall_impl(
+    const simd_exec &,
+    Iterable &&iter,
+    RAJA::detail::ForallParamWrapper<ParamTuple, LoopBody> &loop_body)
+{
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+  loop_body.template exec_lanes<reduce_lanes>(begin, distance);
+}
+
 }  // namespace simd
 
 }  // namespace policy
@@ -18,6 +18,8 @@
 #ifndef policy_simd_HPP
 #define policy_simd_HPP
 
+#include <type_traits>
+
 #include "RAJA/policy/PolicyBase.hpp"
 
 //
@@ -50,6 +52,16 @@ struct simd_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
 
 using policy::simd::simd_exec;
 
+namespace type_traits
+{
+
+//! simd_exec is a sequential policy; this picks it out from the others
+template <typename Pol>
+struct is_simd_exec : std::is_same<camp::decay<Pol>, simd_exec> {
+};
+
+}  // end of namespace type_traits
+
 }  // end of namespace RAJA
 
 #endif
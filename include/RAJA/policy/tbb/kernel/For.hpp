@@ -0,0 +1,158 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for TBB statement::For executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tbb_kernel_For_HPP
+#define RAJA_policy_tbb_kernel_For_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <tbb/tbb.h>
+
+#include "RAJA/pattern/kernel/For.hpp"
+#include "RAJA/pattern/kernel/Reduce.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/policy/tbb/forall.hpp"
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+
+/*!
+ * Executor for a statement::For using a TBB policy.
+ *
+ * Without any enclosed statement::Reduce<tbb_reduce> this is the generic
+ * forall_impl path.  Otherwise each chunk runs on a private copy of the loop
+ * data and folds the reduced Params into its own partial results, which are
+ * combined into a per-thread result at the end of the chunk.  The per-thread
+ * results are combined once when the loop finishes, after which the enclosed
+ * statements of each Reduce run once with the reduced value.
+ */
+template <typename ExecPolicy, camp::idx_t ArgumentId, typename... EnclosedStmts>
+struct TbbForExecutor {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using data_t = camp::decay<Data>;
+    exec_impl<data_t>(
+        data,
+        enclosed_reduce_statements_t<tbb_reduce,
+                                     camp::list<EnclosedStmts...>>{});
+  }
+
+  template <typename data_t>
+  static RAJA_INLINE void exec_impl(data_t &data, camp::list<>)
+  {
+    ForWrapper<ArgumentId, data_t, EnclosedStmts...> for_wrapper(data);
+
+    auto len = segment_length<ArgumentId>(data);
+    using len_t = decltype(len);
+
+    forall_impl(ExecPolicy{}, TypedRangeSegment<len_t>(0, len), for_wrapper);
+  }
+
+  template <typename data_t, typename... ReduceStmts>
+  static RAJA_INLINE void exec_impl(data_t &data,
+                                    camp::list<ReduceStmts...>)
+  {
+    using accumulators_t =
+        ReduceAccumulatorList<data_t, camp::list<ReduceStmts...>>;
+
+    auto len = segment_length<ArgumentId>(data);
+    using len_t = decltype(len);
+    using brange = ::tbb::blocked_range<len_t>;
+
+    ::tbb::enumerable_thread_specific<accumulators_t> partials;
+
+    auto body = [&](const brange &r) {
+      accumulators_t partial;
+
+      data_t private_data(data);
+      partial.reset(private_data);
+
+      ForWrapper<ArgumentId, data_t, EnclosedStmts...> for_wrapper(
+          private_data);
+
+      partial.push();
+      for (len_t i = r.begin(); i != r.end(); ++i) {
+        for_wrapper(i);
+      }
+      partial.pop();
+
+      partials.local().combine(partial);
+    };
+
+    run(ExecPolicy{}, brange(0, len, grain_size(ExecPolicy{})), body);
+
+    accumulators_t result(data);
+    for (auto const &partial : partials) {
+      result.combine(partial);
+    }
+    result.finish(data);
+  }
+
+  static size_t grain_size(tbb_for_dynamic const &p) { return p.grain_size; }
+
+  template <size_t ChunkSize>
+  static constexpr size_t grain_size(tbb_for_static<ChunkSize> const &)
+  {
+    return ChunkSize;
+  }
+
+  template <typename Range, typename Body>
+  static void run(tbb_for_dynamic const &, Range const &range, Body const &body)
+  {
+    ::tbb::parallel_for(range, body);
+  }
+
+  template <size_t ChunkSize, typename Range, typename Body>
+  static void run(tbb_for_static<ChunkSize> const &,
+                  Range const &range,
+                  Body const &body)
+  {
+    ::tbb::parallel_for(range, body, tbb_static_partitioner{});
+  }
+};
+
+
+template <camp::idx_t ArgumentId, typename... EnclosedStmts>
+struct StatementExecutor<
+    statement::For<ArgumentId, tbb_for_dynamic, EnclosedStmts...>>
+    : TbbForExecutor<tbb_for_dynamic, ArgumentId, EnclosedStmts...> {
+};
+
+template <camp::idx_t ArgumentId, size_t ChunkSize, typename... EnclosedStmts>
+struct StatementExecutor<statement::For<ArgumentId,
+                                        tbb_for_static<ChunkSize>,
+                                        EnclosedStmts...>>
+    : TbbForExecutor<tbb_for_static<ChunkSize>, ArgumentId, EnclosedStmts...> {
+};
+
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_TBB)
+
+#endif  // closing endif for header file include guard
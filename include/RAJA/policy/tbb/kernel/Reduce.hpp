@@ -0,0 +1,58 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for TBB statement::Reduce executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tbb_kernel_Reduce_HPP
+#define RAJA_policy_tbb_kernel_Reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include "RAJA/pattern/kernel/Reduce.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+//
+// Executor that handles reductions across the chunks of the innermost
+// enclosing TBB statement::For
+//
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts>
+struct StatementExecutor<
+    statement::Reduce<tbb_reduce, ReduceOperator, ParamId, EnclosedStmts...>>
+    : HostReduceStatementExecutor<statement::
+                                      Reduce<tbb_reduce,
+                                             ReduceOperator,
+                                             ParamId,
+                                             EnclosedStmts...>> {
+};
+
+
+}  // namespace internal
+
+}  // end namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_TBB)
+
+#endif /* RAJA_policy_tbb_kernel_Reduce_HPP */
@@ -37,6 +37,7 @@
 
 #include "RAJA/policy/tbb/policy.hpp"
 
+#include "RAJA/util/ReducerPool.hpp"
 #include "RAJA/util/types.hpp"
 
 namespace RAJA
@@ -44,11 +45,46 @@ namespace RAJA
 
 namespace detail
 {
+/*!
+ * \brief Pooled per-thread storage for TBB reductions.
+ *
+ * Each acquisition bumps the epoch, thread values written under an older
+ * epoch are treated as holding the identity, so a recycled slab keeps its
+ * per-thread elements and needs no clearing pass.
+ */
+template <typename T>
+struct ReduceTBBSlab {
+  struct Slot {
+    T val;
+    size_t epoch = 0;
+  };
+
+  //! TBB native per-thread container
+  tbb::enumerable_thread_specific<Slot> slots;
+  size_t epoch = 0;
+  T identity;
+
+  void prepare(T identity_)
+  {
+    ++epoch;
+    identity = identity_;
+  }
+
+  T& local()
+  {
+    Slot& slot = slots.local();
+    if (slot.epoch != epoch) {
+      slot.val = identity;
+      slot.epoch = epoch;
+    }
+    return slot.val;
+  }
+};
+
 template <typename T, typename Reduce>
 class ReduceTBB
 {
-  //! TBB native per-thread container
-  std::shared_ptr<tbb::combinable<T>> data;
+  PooledStorage<ReduceTBBSlab<T>> data;
 
 public:
   //! default constructor calls the reset method
@@ -62,15 +98,23 @@ public:
 
   void reset(T init_val, T initializer)
   {
-    data = std::shared_ptr<tbb::combinable<T>>(
-        std::make_shared<tbb::combinable<T>>([=]() { return initializer; }));
+    data->prepare(initializer);
     data->local() = init_val;
   }
 
   /*!
    *  \return the calculated reduced value
    */
-  T get() const { return data->combine(typename Reduce::operator_type{}); }
+  T get() const
+  {
+    T res = data->identity;
+    for (auto& slot : data->slots) {
+      if (slot.epoch == data->epoch) {
+        Reduce{}(res, slot.val);
+      }
+    }
+    return res;
+  }
 
   /*!
    *  \return update the local value
@@ -23,12 +23,17 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <vector>
 
 #include <tbb/tbb.h>
 
+#include "RAJA/internal/Iterators.hpp"
+
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/macros.hpp"
 
+#include "RAJA/pattern/detail/scan.hpp"
+
 #include "RAJA/policy/sequential/policy.hpp"
 
 namespace RAJA
@@ -73,10 +78,14 @@ struct scan_adapter_inclusive : scan_adapter<T, InIter, OutIter, Fn> {
   template <typename Tag>
   void operator()(const tbb::blocked_range<Index_type>& r, Tag)
   {
+    if (Tag::is_final_scan()) {
+      this->agg = ::RAJA::detail::scan_block<false>(
+          this->in, this->out, r.begin(), r.end(), this->fn, this->agg);
+      return;
+    }
     T temp = this->agg;
     for (Index_type i = r.begin(); i < r.end(); ++i) {
       temp = this->fn(temp, this->in[i]);
-      if (Tag::is_final_scan()) this->out[i] = temp;
     }
     this->agg = temp;
   }
@@ -91,13 +100,138 @@ struct scan_adapter_exclusive : scan_adapter<T, InIter, OutIter, Fn> {
   void operator()(const tbb::blocked_range<Index_type>& r, Tag)
   {
     if (r.begin() == 0) this->agg = this->init;
+    if (Tag::is_final_scan()) {
+      this->agg = ::RAJA::detail::scan_block<true>(
+          this->in, this->out, r.begin(), r.end(), this->fn, this->agg);
+      return;
+    }
     for (Index_type i = r.begin(); i < r.end(); ++i) {
-      auto t = this->in[i];
-      if (Tag::is_final_scan()) this->out[i] = this->agg;
-      this->agg = this->fn(this->agg, t);
+      this->agg = this->fn(this->agg, this->in[i]);
+    }
+  }
+};
+/*!
+ * parallel_scan body of a segmented scan; the running state is the
+ * SegmentPartial of everything to the left of the current range.
+ */
+template <bool Exclusive,
+          typename T,
+          typename InIter,
+          typename Heads,
+          typename OutIter,
+          typename Fn>
+struct segmented_scan_adapter {
+  using Partial = ::RAJA::detail::SegmentPartial<T>;
+  using PartialOp = ::RAJA::detail::segmented_op<T, Fn>;
+
+  Partial agg;
+  InIter in;
+  Heads heads;
+  OutIter out;
+  Fn fn;
+  T const init;
+
+  segmented_scan_adapter(InIter in_,
+                         Heads heads_,
+                         OutIter out_,
+                         Fn fn_,
+                         T const& init_)
+      : agg(PartialOp::identity()),
+        in(in_),
+        heads(heads_),
+        out(out_),
+        fn(fn_),
+        init(init_)
+  {
+  }
+
+  segmented_scan_adapter(segmented_scan_adapter& b, tbb::split)
+      : agg(PartialOp::identity()),
+        in(b.in),
+        heads(b.heads),
+        out(b.out),
+        fn(b.fn),
+        init(b.init)
+  {
+  }
+
+  template <typename Tag>
+  void operator()(const tbb::blocked_range<Index_type>& r, Tag)
+  {
+    if (Tag::is_final_scan()) {
+      agg = ::RAJA::detail::segmented_scan_block<Exclusive>(
+          in, out, r.begin(), r.end(), heads.at(r.begin()), fn, init, agg);
+    } else {
+      agg = ::RAJA::detail::segmented_reduce_block(
+          in, r.begin(), r.end(), heads.at(r.begin()), fn, init, agg);
     }
   }
+
+  void reverse_join(const segmented_scan_adapter& a)
+  {
+    agg = PartialOp{fn}(a.agg, agg);
+  }
+  void assign(const segmented_scan_adapter& b) { agg = b.agg; }
 };
+/*!
+ * Scan-then-propagate over one block per worker thread, for inputs that
+ * must be read only once, such as transform iterators: each block of the
+ * input is scanned straight into the output, the block totals are scanned
+ * into the starting value of each block, and that value is then combined
+ * into each block of the output.  tbb::parallel_scan would read each input
+ * value in both its pre-scan and its final scan.
+ */
+template <bool Exclusive,
+          typename Value,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+void tbb_scan_propagate(Iter begin, Iter end, OutIter out, BinFn f, Value init)
+{
+  const Index_type n = end - begin;
+  if (n <= 0) return;
+
+  const Index_type nblocks = ::std::min<Index_type>(
+      n, tbb::this_task_arena::max_concurrency());
+  if (nblocks == 1) {
+    ::RAJA::detail::scan_block<Exclusive>(begin, out, 0, n, f, init);
+    return;
+  }
+
+  ::std::vector<Value> sums(nblocks, init);
+  Value* const partial = sums.data();
+  const tbb::blocked_range<Index_type> blocks(0, nblocks, 1);
+  auto block_begin = [=](Index_type b) { return b * n / nblocks; };
+
+  tbb::parallel_for(blocks, [=](const tbb::blocked_range<Index_type>& r) {
+    for (Index_type b = r.begin(); b < r.end(); ++b) {
+      partial[b] =
+          ::RAJA::detail::scan_block<Exclusive>(begin,
+                                                out,
+                                                block_begin(b),
+                                                block_begin(b + 1),
+                                                f,
+                                                Value(BinFn::identity()));
+    }
+  });
+
+  Value agg = init;
+  for (Index_type b = 0; b < nblocks; ++b) {
+    const Value sum = partial[b];
+    partial[b] = agg;
+    agg = f(agg, sum);
+  }
+
+  tbb::parallel_for(blocks, [=](const tbb::blocked_range<Index_type>& r) {
+    for (Index_type b = r.begin(); b < r.end(); ++b) {
+      if (!Exclusive && b == 0) continue;
+      const Value prefix = partial[b];
+      for (Index_type i = block_begin(b); i < block_begin(b + 1); ++i) {
+        *(out + i) = f(prefix, *(out + i));
+      }
+    }
+  });
+}
 }  // namespace detail
 
 /*!
@@ -112,7 +246,7 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> inclusive_inplace(
     BinFn f)
 {
   auto adapter = detail::scan_adapter_inclusive<
-      typename std::remove_reference<decltype(*begin)>::type,
+      typename std::iterator_traits<Iter>::value_type,
       Iter,
       Iter,
       BinFn>{begin, begin, f, BinFn::identity()};
@@ -134,7 +268,7 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive_inplace(
     T v)
 {
   auto adapter = detail::scan_adapter_exclusive<
-      typename std::remove_reference<decltype(*begin)>::type,
+      typename std::iterator_traits<Iter>::value_type,
       Iter,
       Iter,
       BinFn>{begin, begin, f, v};
@@ -156,7 +290,7 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> inclusive(
     BinFn f)
 {
   auto adapter = detail::scan_adapter_inclusive<
-      typename std::remove_reference<decltype(*begin)>::type,
+      typename std::iterator_traits<OutIter>::value_type,
       Iter,
       OutIter,
       BinFn>{begin, out, f, BinFn::identity()};
@@ -183,7 +317,7 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive(
     T v)
 {
   auto adapter = detail::scan_adapter_exclusive<
-      typename std::remove_reference<decltype(*begin)>::type,
+      typename std::iterator_traits<OutIter>::value_type,
       Iter,
       OutIter,
       BinFn>{begin, out, f, v};
@@ -192,6 +326,112 @@ concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive(
                      adapter);
 }
 
+/*!
+        \brief explicit inclusive scan of unop applied to each input value,
+   calling unop at most once per value
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename UnaryOp,
+          typename BinFn>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> transform_inclusive(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    UnaryOp unop,
+    BinFn f)
+{
+  using Value = typename std::iterator_traits<OutIter>::value_type;
+  detail::tbb_scan_propagate<false, Value>(
+      Iterators::make_transform_iterator(begin, unop),
+      Iterators::make_transform_iterator(end, unop),
+      out,
+      f,
+      Value(BinFn::identity()));
+}
+
+/*!
+        \brief explicit exclusive scan of unop applied to each input value,
+   calling unop at most once per value
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename UnaryOp,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> transform_exclusive(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    UnaryOp unop,
+    BinFn f,
+    T v)
+{
+  using Value = typename std::iterator_traits<OutIter>::value_type;
+  detail::tbb_scan_propagate<true, Value>(
+      Iterators::make_transform_iterator(begin, unop),
+      Iterators::make_transform_iterator(end, unop),
+      out,
+      f,
+      Value(v));
+}
+
+/*!
+        \brief explicit inclusive segmented scan given input range, segment
+   heads, output, and function
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Heads,
+          typename OutIter,
+          typename BinFn>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> inclusive_segmented(
+    const ExecPolicy&,
+    Iter begin,
+    Index_type first,
+    Index_type last,
+    Heads heads,
+    OutIter out,
+    BinFn f)
+{
+  using Value = typename std::iterator_traits<OutIter>::value_type;
+  auto adapter =
+      detail::segmented_scan_adapter<false, Value, Iter, Heads, OutIter, BinFn>{
+          begin, heads, out, f, BinFn::identity()};
+  tbb::parallel_scan(tbb::blocked_range<Index_type>{first, last}, adapter);
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, segment
+   heads, output, function, and initial value of each segment
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename Heads,
+          typename OutIter,
+          typename BinFn,
+          typename T>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> exclusive_segmented(
+    const ExecPolicy&,
+    Iter begin,
+    Index_type first,
+    Index_type last,
+    Heads heads,
+    OutIter out,
+    BinFn f,
+    T v)
+{
+  using Value = typename std::iterator_traits<OutIter>::value_type;
+  auto adapter =
+      detail::segmented_scan_adapter<true, Value, Iter, Heads, OutIter, BinFn>{
+          begin, heads, out, f, Value(v)};
+  tbb::parallel_scan(tbb::blocked_range<Index_type>{first, last}, adapter);
+}
+
 }  // namespace scan
 
 }  // namespace impl
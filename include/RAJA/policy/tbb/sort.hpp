@@ -0,0 +1,134 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_tbb_HPP
+#define RAJA_sort_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/pattern/detail/sort.hpp"
+#include "RAJA/policy/tbb/policy.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+
+/*!
+ * Stable merge sort: the input is split into a few blocks per worker
+ * thread, each block is stable sorted by its own task, and the blocks are
+ * merged pairwise, alternating between the input and a buffer.  Every
+ * merge pass is split into equal shares of the output.
+ */
+template <typename Iter, typename Compare>
+void tbb_stable_merge_sort(Iter begin, Iter end, Compare comp)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+
+  const Index_type n = end - begin;
+  const Index_type nleaves = ::std::min<Index_type>(
+      n / ::RAJA::detail::sort_serial_threshold + 1,
+      4 * tbb::this_task_arena::max_concurrency());
+  if (nleaves <= 1) {
+    ::std::stable_sort(begin, end, comp);
+    return;
+  }
+
+  const ::RAJA::detail::MergeRuns runs{n, nleaves};
+  const tbb::blocked_range<Index_type> leaves(0, nleaves, 1);
+
+  tbb::parallel_for(leaves, [=](const tbb::blocked_range<Index_type>& r) {
+    for (Index_type l = r.begin(); l < r.end(); ++l) {
+      ::std::stable_sort(begin + runs.leaf_begin(l),
+                         begin + runs.leaf_begin(l + 1),
+                         comp);
+    }
+  });
+
+  ::std::vector<Value> buffer(n);
+  Value* const tmp = buffer.data();
+  bool in_buffer = false;
+  for (Index_type width = 1; width < nleaves; width *= 2) {
+    tbb::parallel_for(leaves, [=](const tbb::blocked_range<Index_type>& r) {
+      const Index_type o0 = runs.leaf_begin(r.begin());
+      const Index_type o1 = runs.leaf_begin(r.end());
+      if (in_buffer) {
+        ::RAJA::detail::merge_pass_part(tmp, begin, runs, width, o0, o1, comp);
+      } else {
+        ::RAJA::detail::merge_pass_part(begin, tmp, runs, width, o0, o1, comp);
+      }
+    });
+    in_buffer = !in_buffer;
+  }
+
+  if (in_buffer) {
+    tbb::parallel_for(leaves, [=](const tbb::blocked_range<Index_type>& r) {
+      ::std::move(tmp + runs.leaf_begin(r.begin()),
+                  tmp + runs.leaf_begin(r.end()),
+                  begin + runs.leaf_begin(r.begin()));
+    });
+  }
+}
+
+}  // namespace detail
+
+/*!
+        \brief sort given range and comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> unstable(
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  tbb::parallel_sort(begin, end, comp);
+}
+
+/*!
+        \brief stable sort given range and comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> stable(
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::tbb_stable_merge_sort(begin, end, comp);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
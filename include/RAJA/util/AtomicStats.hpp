@@ -0,0 +1,142 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file declaring the per call site atomic statistics
+ *          collected in builds with RAJA_ENABLE_ATOMIC_STATS.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_AtomicStats_HPP
+#define RAJA_util_AtomicStats_HPP
+
+#include "RAJA/config.hpp"
+
+#include <string>
+#include <vector>
+
+namespace RAJA
+{
+namespace util
+{
+
+//! number of operations and compare-and-swap retries of one atomic call site
+struct AtomicSiteStats {
+  std::string file;
+  unsigned line;
+  unsigned long long operations;
+  unsigned long long retries;
+};
+
+#if defined(RAJA_ENABLE_ATOMIC_STATS)
+
+//! source location of a call to one of the RAJA::atomicXXX functions
+struct AtomicSite {
+  const char *file;
+  unsigned line;
+};
+
+/*!
+ * The counts of all threads merged by call site, most CAS retries first.
+ * Must not run while other threads perform atomics.
+ */
+std::vector<AtomicSiteStats> getAtomicStats();
+
+//! zero the counts; must not run while other threads perform atomics
+void resetAtomicStats();
+
+#endif  // RAJA_ENABLE_ATOMIC_STATS
+
+}  // namespace util
+
+#if defined(RAJA_ENABLE_ATOMIC_STATS)
+
+namespace detail
+{
+
+using util::AtomicSite;
+
+//! count an operation of site in this thread's counters
+void atomic_stats_begin(AtomicSite site);
+
+void atomic_stats_end();
+
+//! count a retry of the operation this thread is performing
+void atomic_stats_retry();
+
+//! counts one operation and attributes CAS retries to it while in scope
+class AtomicStatsScope
+{
+public:
+  explicit AtomicStatsScope(AtomicSite site) { atomic_stats_begin(site); }
+
+  ~AtomicStatsScope() { atomic_stats_end(); }
+
+  AtomicStatsScope(AtomicStatsScope const &) = delete;
+  AtomicStatsScope &operator=(AtomicStatsScope const &) = delete;
+};
+
+}  // namespace detail
+
+#endif  // RAJA_ENABLE_ATOMIC_STATS
+
+}  // namespace RAJA
+
+/*!
+ * The user-facing atomic functions take a defaulted AtomicSite parameter
+ * holding the location of their caller, so it costs nothing at call sites.
+ * Proxies such as AtomicRef take the site where they are created, keep it
+ * in a member and pass it on to the atomic functions they call.
+ */
+#if defined(RAJA_ENABLE_ATOMIC_STATS)
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_FILE)
+#define RAJA_ATOMIC_SITE_CURRENT {__builtin_FILE(), __builtin_LINE()}
+#endif
+#elif defined(__GNUC__)
+#define RAJA_ATOMIC_SITE_CURRENT {__builtin_FILE(), __builtin_LINE()}
+#endif
+
+#if !defined(RAJA_ATOMIC_SITE_CURRENT)
+#define RAJA_ATOMIC_SITE_CURRENT {"unknown", 0}
+#endif
+
+#define RAJA_ATOMIC_SITE_DECL \
+  ::RAJA::util::AtomicSite atomic_site = RAJA_ATOMIC_SITE_CURRENT
+
+#define RAJA_ATOMIC_SITE_PARAM , RAJA_ATOMIC_SITE_DECL
+
+#define RAJA_ATOMIC_SITE_ARG(site) , site
+
+#define RAJA_ATOMIC_SITE_MEMBER(name) ::RAJA::util::AtomicSite name;
+
+#define RAJA_ATOMIC_SITE_INIT(name, site) , name(site)
+
+#define RAJA_ATOMIC_STATS_SCOPE \
+  ::RAJA::detail::AtomicStatsScope atomic_stats_scope(atomic_site)
+
+#define RAJA_ATOMIC_STATS_RETRY() ::RAJA::detail::atomic_stats_retry()
+
+#else
+
+#define RAJA_ATOMIC_SITE_DECL
+#define RAJA_ATOMIC_SITE_PARAM
+#define RAJA_ATOMIC_SITE_ARG(site)
+#define RAJA_ATOMIC_SITE_MEMBER(name)
+#define RAJA_ATOMIC_SITE_INIT(name, site)
+#define RAJA_ATOMIC_STATS_SCOPE
+#define RAJA_ATOMIC_STATS_RETRY()
+
+#endif  // RAJA_ENABLE_ATOMIC_STATS
+
+#endif  // closing endif for header file include guard
@@ -24,6 +24,7 @@
 #include <iostream>
 #include <type_traits>
 
+#include "RAJA/util/AtomicStats.hpp"
 #include "RAJA/util/StaticLayout.hpp"
 
 namespace RAJA
@@ -86,10 +87,11 @@ struct AtomicTypedLocalArray<AtomicPolicy, DataType, camp::idx_seq<Perm ...>,
   static const camp::idx_t NumElem = layout_t::size();
 
   RAJA_HOST_DEVICE
-  atomic_ref_t operator()(IndexTypes ... indices) const
+  atomic_ref_t operator()(IndexTypes ... indices RAJA_ATOMIC_SITE_PARAM) const
   {
     return(atomic_ref_t(&m_arrayPtr[layout_t::s_oper(stripIndexType(indices)
-                                                     ...)]));
+                                                     ...)]
+                        RAJA_ATOMIC_SITE_ARG(atomic_site)));
   }
 };
 
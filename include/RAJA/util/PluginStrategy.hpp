@@ -8,6 +8,9 @@
 #ifndef RAJA_PluginStrategy_HPP
 #define RAJA_PluginStrategy_HPP
 
+#include <vector>
+
+#include "RAJA/util/AtomicStats.hpp"
 #include "RAJA/util/PluginContext.hpp"
 #include "RAJA/util/Registry.hpp"
 
@@ -25,6 +28,9 @@ class PluginStrategy
     virtual void preLaunch(PluginContext p) = 0;
 
     virtual void postLaunch(PluginContext p) = 0;
+
+    //! called at program end in builds with RAJA_ENABLE_ATOMIC_STATS
+    virtual void atomicStats(std::vector<AtomicSiteStats> const &) {}
 };
 
 using PluginRegistry = Registry<PluginStrategy>;
@@ -0,0 +1,256 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Pool of reusable storage objects for host reducers.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ReducerPool_HPP
+#define RAJA_util_ReducerPool_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Process-wide pool of Storage objects recycled through a lock-free
+ *        free list.
+ *
+ * Storage objects are created on first demand and are never destroyed, so
+ * reducers that acquire and release storage do no heap allocation once the
+ * pool is warm.  Nodes are addressed by index and the list head packs a
+ * version tag next to the index, which keeps the compare-and-swap free of
+ * ABA problems.  If the fixed index space is ever exhausted nodes are heap
+ * allocated individually instead.
+ *
+ * Each thread keeps a few released nodes in a small private cache in front
+ * of the shared list, so the common construct/destroy pattern of a reducer
+ * on one thread does not touch shared atomics at all.
+ */
+template <typename Storage>
+class ReducerPool
+{
+  static constexpr std::uint32_t block_bits = 6;
+  static constexpr std::uint32_t block_size = 1u << block_bits;
+  static constexpr std::uint32_t max_blocks = 4096;
+  static constexpr std::uint32_t capacity = block_size * max_blocks;
+  static constexpr std::uint32_t unpooled = ~std::uint32_t(0);
+  static constexpr int cache_size = 8;
+
+public:
+  struct Node {
+    Storage storage;
+    std::atomic<int> refs{0};
+    std::uint32_t index = unpooled;
+    std::atomic<std::uint32_t> next{0};
+  };
+
+  //! the pool is intentionally never destroyed so that thread caches
+  //! flushed during process teardown always find it alive
+  static ReducerPool& getInstance()
+  {
+    static ReducerPool* pool = new ReducerPool;
+    return *pool;
+  }
+
+  //! take a node from this thread's cache or the shared free list
+  Node* acquire()
+  {
+    ThreadCache& cache = thread_cache();
+    if (cache.count > 0) {
+      return cache.nodes[--cache.count];
+    }
+    return pop();
+  }
+
+  //! return a node to this thread's cache or the shared free list
+  void release(Node* node)
+  {
+    ThreadCache& cache = thread_cache();
+    if (cache.count < cache_size) {
+      cache.nodes[cache.count++] = node;
+      return;
+    }
+    push(node);
+  }
+
+  ReducerPool(const ReducerPool&) = delete;
+  ReducerPool& operator=(const ReducerPool&) = delete;
+
+private:
+  struct Block {
+    Node nodes[block_size];
+  };
+
+  struct ThreadCache {
+    Node* nodes[cache_size];
+    int count = 0;
+
+    ~ThreadCache()
+    {
+      while (count > 0) {
+        getInstance().push(nodes[--count]);
+      }
+    }
+  };
+
+  static ThreadCache& thread_cache()
+  {
+    static thread_local ThreadCache cache;
+    return cache;
+  }
+
+  ReducerPool()
+  {
+    for (std::uint32_t b = 0; b < max_blocks; ++b) {
+      blocks[b].store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  //! pop a node off the shared free list, growing the pool if it is empty
+  Node* pop()
+  {
+    std::uint64_t old_head = head.load(std::memory_order_acquire);
+    while (index_of(old_head) != 0) {
+      Node* node = node_at(index_of(old_head) - 1);
+      std::uint64_t new_head =
+          pack(tag_of(old_head) + 1,
+               node->next.load(std::memory_order_relaxed));
+      if (head.compare_exchange_weak(old_head,
+                                     new_head,
+                                     std::memory_order_acq_rel,
+                                     std::memory_order_acquire)) {
+        return node;
+      }
+    }
+
+    std::uint32_t idx = count.fetch_add(1, std::memory_order_relaxed);
+    if (idx >= capacity) {
+      return new Node;
+    }
+
+    std::atomic<Block*>& slot = blocks[idx >> block_bits];
+    Block* block = slot.load(std::memory_order_acquire);
+    if (block == nullptr) {
+      Block* new_block = new Block;
+      if (slot.compare_exchange_strong(block,
+                                       new_block,
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_acquire)) {
+        block = new_block;
+      } else {
+        delete new_block;
+      }
+    }
+
+    Node* node = &block->nodes[idx & (block_size - 1)];
+    node->index = idx;
+    return node;
+  }
+
+  //! push a node back onto the shared free list
+  void push(Node* node)
+  {
+    if (node->index == unpooled) {
+      delete node;
+      return;
+    }
+
+    std::uint64_t old_head = head.load(std::memory_order_relaxed);
+    std::uint64_t new_head;
+    do {
+      node->next.store(index_of(old_head), std::memory_order_relaxed);
+      new_head = pack(tag_of(old_head) + 1, node->index + 1);
+    } while (!head.compare_exchange_weak(old_head,
+                                         new_head,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed));
+  }
+
+  static constexpr std::uint64_t pack(std::uint64_t tag, std::uint32_t index)
+  {
+    return (tag << 32) | index;
+  }
+  static constexpr std::uint32_t index_of(std::uint64_t h)
+  {
+    return static_cast<std::uint32_t>(h);
+  }
+  static constexpr std::uint64_t tag_of(std::uint64_t h) { return h >> 32; }
+
+  Node* node_at(std::uint32_t idx)
+  {
+    Block* block = blocks[idx >> block_bits].load(std::memory_order_acquire);
+    return &block->nodes[idx & (block_size - 1)];
+  }
+
+  //! list head: version tag in the high word, node index + 1 in the low word
+  std::atomic<std::uint64_t> head{0};
+  //! number of pooled nodes handed out so far
+  std::atomic<std::uint32_t> count{0};
+  std::atomic<Block*> blocks[max_blocks];
+};
+
+/*!
+ * \brief Reference counted handle to pooled reducer storage.
+ *
+ * Copies share the same Storage object, which returns to its pool when the
+ * last handle is destroyed.
+ */
+template <typename Storage>
+class PooledStorage
+{
+  using pool_type = ReducerPool<Storage>;
+  using node_type = typename pool_type::Node;
+
+public:
+  PooledStorage() : node(pool_type::getInstance().acquire())
+  {
+    node->refs.store(1, std::memory_order_relaxed);
+  }
+
+  PooledStorage(const PooledStorage& other) : node(other.node)
+  {
+    node->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  PooledStorage& operator=(const PooledStorage&) = delete;
+
+  ~PooledStorage()
+  {
+    // a count of one means no other handle exists that could copy this one
+    if (node->refs.load(std::memory_order_acquire) == 1
+        || node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      pool_type::getInstance().release(node);
+    }
+  }
+
+  Storage* operator->() const { return &node->storage; }
+  Storage& operator*() const { return node->storage; }
+
+private:
+  node_type* node;
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
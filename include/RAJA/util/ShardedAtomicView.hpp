@@ -0,0 +1,442 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a view that buffers atomic updates per
+ *          thread.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ShardedAtomicView_HPP
+#define RAJA_util_ShardedAtomicView_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/atomic.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/policy/sequential/policy.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! targets of at most this many elements are buffered densely
+constexpr Index_type sharded_dense_max = 1 << 16;
+
+//! log2 of the slots of each hashed buffer, which is flushed when half of
+//! them are used
+constexpr int sharded_hash_bits = 12;
+
+constexpr Index_type sharded_hash_slots = Index_type(1) << sharded_hash_bits;
+
+//! a hashed buffer that fills up having combined fewer than 1 in this many
+//! of its updates stops buffering until the next flush
+constexpr Index_type sharded_min_reuse = 4;
+
+//! entries of each thread's cache of the buffers it owns
+constexpr int sharded_cache_size = 8;
+
+//! number of target elements summed by each task of a dense flush
+constexpr Index_type sharded_flush_block = 1 << 12;
+
+/*!
+ * One thread's buffer of updates.  A dense buffer holds a value for every
+ * target element and the range [lo, hi) of those that were updated; a
+ * hashed buffer holds the updated elements' indices and values in an open
+ * addressing table, the slots in use and the number of updates since it
+ * was last emptied.
+ */
+template <typename T>
+struct ShardBuffer {
+  std::vector<T> values;
+  Index_type lo = 0;
+  Index_type hi = 0;
+  std::vector<Index_type> keys;
+  std::vector<Index_type> used;
+  Index_type updates = 0;
+};
+
+//! the buffer this thread owns for a view, looked up by the view's id
+struct ShardCacheEntry {
+  std::uint64_t id = 0;
+  void *buffer = nullptr;
+};
+
+RAJA_INLINE ShardCacheEntry *shard_cache()
+{
+  static thread_local ShardCacheEntry cache[sharded_cache_size];
+  return cache;
+}
+
+//! ids are never reused, so a cache entry of a destroyed view never matches
+RAJA_INLINE std::uint64_t next_shard_id()
+{
+  static std::atomic<std::uint64_t> id{0};
+  return ++id;
+}
+
+/*!
+ * State shared by all copies of a ShardedAtomicView: the target and the
+ * buffers of the threads that have updated it.
+ */
+template <typename T, typename AtomicPolicy>
+class ShardedState
+{
+public:
+  ShardedState(T *target, Index_type size RAJA_ATOMIC_SITE_PARAM)
+      : target_(target),
+        size_(size),
+        dense_(size <= sharded_dense_max),
+        direct_(false),
+        id_(next_shard_id()) RAJA_ATOMIC_SITE_INIT(site_, atomic_site)
+  {
+  }
+
+  //! updates left for the destructor are counted where the view was made
+  ~ShardedState() { flush(seq_exec{} RAJA_ATOMIC_SITE_ARG(site_)); }
+
+  ShardedState(ShardedState const &) = delete;
+  ShardedState &operator=(ShardedState const &) = delete;
+
+  RAJA_INLINE void add(Index_type i, T value RAJA_ATOMIC_SITE_PARAM)
+  {
+    if (direct_.load(std::memory_order_relaxed)) {
+      RAJA::atomicAdd<AtomicPolicy>(
+          target_ + i, value RAJA_ATOMIC_SITE_ARG(atomic_site));
+      return;
+    }
+    ShardBuffer<T> &buf = buffer();
+    if (dense_) {
+      buf.values[i] += value;
+      buf.lo = std::min(buf.lo, i);
+      buf.hi = std::max(buf.hi, i + 1);
+    } else {
+      add_hashed(buf, i, value RAJA_ATOMIC_SITE_ARG(atomic_site));
+    }
+  }
+
+  /*!
+   * Add the buffered updates to the target and clear the buffers.  Must
+   * not run while other threads update the view.
+   */
+  template <typename ExecPolicy>
+  void flush(ExecPolicy const &p RAJA_ATOMIC_SITE_PARAM)
+  {
+    direct_.store(false, std::memory_order_relaxed);
+    if (buffers_.empty()) return;
+    ShardBuffer<T> *const *bufs = &buffers_[0];
+    const Index_type nbufs = buffers_.size();
+    T *const target = target_;
+
+    if (dense_) {
+      Index_type lo = size_;
+      Index_type hi = 0;
+      for (Index_type b = 0; b < nbufs; ++b) {
+        lo = std::min(lo, bufs[b]->lo);
+        hi = std::max(hi, bufs[b]->hi);
+      }
+      if (lo >= hi) return;
+      // each task sums one range of elements over all buffers
+      const Index_type nblocks =
+          (hi - lo + sharded_flush_block - 1) / sharded_flush_block;
+      forall(p, RangeSegment(0, nblocks), [=](Index_type blk) {
+        const Index_type i0 = lo + blk * sharded_flush_block;
+        const Index_type i1 = std::min(hi, i0 + sharded_flush_block);
+        for (Index_type b = 0; b < nbufs; ++b) {
+          ShardBuffer<T> &buf = *bufs[b];
+          const Index_type j0 = std::max(i0, buf.lo);
+          const Index_type j1 = std::min(i1, buf.hi);
+          for (Index_type i = j0; i < j1; ++i) {
+            target[i] += buf.values[i];
+            buf.values[i] = T(0);
+          }
+        }
+      });
+      for (Index_type b = 0; b < nbufs; ++b) {
+        bufs[b]->lo = size_;
+        bufs[b]->hi = 0;
+      }
+    } else {
+      // buffers may hold the same element, so each adds atomically
+      forall(p, RangeSegment(0, nbufs), [=](Index_type b) {
+        drain(*bufs[b], target RAJA_ATOMIC_SITE_ARG(atomic_site));
+      });
+    }
+  }
+
+private:
+  ShardBuffer<T> &buffer()
+  {
+    ShardCacheEntry &entry =
+        shard_cache()[id_ % static_cast<std::uint64_t>(sharded_cache_size)];
+    if (entry.id != id_) {
+      entry.id = id_;
+      entry.buffer = thread_buffer();
+    }
+    return *static_cast<ShardBuffer<T> *>(entry.buffer);
+  }
+
+  //! the buffer of this thread, which is created the first time the
+  //! thread updates the view
+  ShardBuffer<T> *thread_buffer()
+  {
+    const std::thread::id self = std::this_thread::get_id();
+    std::lock_guard<std::mutex> guard(lock_);
+    for (size_t b = 0; b < owners_.size(); ++b) {
+      if (owners_[b] == self) return buffers_[b];
+    }
+
+    std::unique_ptr<ShardBuffer<T>> buf(new ShardBuffer<T>);
+    if (dense_) {
+      buf->values.assign(size_, T(0));
+      buf->lo = size_;
+      buf->hi = 0;
+    } else {
+      buf->values.assign(sharded_hash_slots, T(0));
+      buf->keys.assign(sharded_hash_slots, Index_type(-1));
+      buf->used.reserve(sharded_hash_slots / 2);
+    }
+    owned_.push_back(std::move(buf));
+    owners_.push_back(self);
+    buffers_.push_back(owned_.back().get());
+    return buffers_.back();
+  }
+
+  /*!
+   * Updates that scatter widely over a large target rarely meet again in
+   * the table, and buffering them only adds work, so once a buffer fills up
+   * having combined few updates, the view adds updates straight to the
+   * target until the next flush.
+   */
+  RAJA_INLINE void add_hashed(ShardBuffer<T> &buf,
+                              Index_type i,
+                              T value RAJA_ATOMIC_SITE_PARAM)
+  {
+    ++buf.updates;
+    const Index_type mask = sharded_hash_slots - 1;
+    Index_type slot = static_cast<Index_type>(
+        (static_cast<std::uint64_t>(i) * 0x9E3779B97F4A7C15ull)
+        >> (64 - sharded_hash_bits));
+    while (buf.keys[slot] != i) {
+      if (buf.keys[slot] < 0) {
+        const Index_type nused = buf.used.size();
+        if (nused >= sharded_hash_slots / 2) {
+          if ((buf.updates - nused) * sharded_min_reuse < buf.updates) {
+            direct_.store(true, std::memory_order_relaxed);
+          }
+          drain(buf, target_ RAJA_ATOMIC_SITE_ARG(atomic_site));
+        }
+        buf.keys[slot] = i;
+        buf.used.push_back(slot);
+        break;
+      }
+      slot = (slot + 1) & mask;
+    }
+    buf.values[slot] += value;
+  }
+
+  //! add the entries of a hashed buffer to the target and empty it
+  static void drain(ShardBuffer<T> &buf, T *target RAJA_ATOMIC_SITE_PARAM)
+  {
+    for (Index_type slot : buf.used) {
+      RAJA::atomicAdd<AtomicPolicy>(target + buf.keys[slot],
+                                    buf.values[slot]
+                                        RAJA_ATOMIC_SITE_ARG(atomic_site));
+      buf.keys[slot] = -1;
+      buf.values[slot] = T(0);
+    }
+    buf.used.clear();
+    buf.updates = 0;
+  }
+
+  T *target_;
+  Index_type size_;
+  bool dense_;
+  std::atomic<bool> direct_;
+  std::uint64_t id_;
+  RAJA_ATOMIC_SITE_MEMBER(site_)
+  std::mutex lock_;
+  std::vector<std::unique_ptr<ShardBuffer<T>>> owned_;
+  std::vector<std::thread::id> owners_;
+  std::vector<ShardBuffer<T> *> buffers_;
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  View whose elements accept atomic additions that are buffered per
+ *         thread and added to the target View on flush.
+ *
+ * Each thread accumulates its updates in a private buffer, so threads that
+ * update the same elements do not contend for their cache lines.  Targets
+ * of up to 2^16 elements get a dense buffer per thread; larger targets get
+ * a fixed-size hash table per thread, which is added to the target with
+ * AtomicPolicy atomics whenever it fills up.  When a table fills up having
+ * combined few updates, the view adds updates straight to the target with
+ * AtomicPolicy atomics until the next flush.
+ *
+ * Copies, such as those captured by a loop body, share the buffers.  The
+ * updates reach the target when flush() is called or when the last copy is
+ * destroyed; flush() must not run while the view is being updated.  The
+ * buffers persist across flushes, so reusing one ShardedAtomicView across
+ * loops avoids reallocating them.
+ *
+ * Host execution policies only.
+ *
+ ******************************************************************************
+ */
+template <typename ViewType, typename AtomicPolicy = RAJA::auto_atomic>
+class ShardedAtomicView
+{
+public:
+  using base_type = ViewType;
+  using value_type = typename base_type::value_type;
+  using state_type = detail::ShardedState<value_type, AtomicPolicy>;
+
+  static_assert(std::is_arithmetic<value_type>::value,
+                "ShardedAtomicView requires arithmetic values");
+
+  //! proxy for one element; supports += and -=
+  class reference
+  {
+  public:
+    RAJA_INLINE reference(state_type *state,
+                          Index_type i RAJA_ATOMIC_SITE_PARAM)
+        : state_(state), i_(i) RAJA_ATOMIC_SITE_INIT(site_, atomic_site)
+    {
+    }
+
+    RAJA_INLINE void operator+=(value_type value) const
+    {
+      state_->add(i_, value RAJA_ATOMIC_SITE_ARG(site_));
+    }
+
+    RAJA_INLINE void operator-=(value_type value) const
+    {
+      state_->add(i_, -value RAJA_ATOMIC_SITE_ARG(site_));
+    }
+
+  private:
+    state_type *state_;
+    Index_type i_;
+    RAJA_ATOMIC_SITE_MEMBER(site_)
+  };
+
+  explicit ShardedAtomicView(ViewType const &view RAJA_ATOMIC_SITE_PARAM)
+      : base_(view),
+        state_(std::make_shared<state_type>(
+            view.data,
+            view.layout.size() RAJA_ATOMIC_SITE_ARG(atomic_site)))
+  {
+  }
+
+  template <typename... ARGS>
+  RAJA_INLINE reference operator()(ARGS &&... args) const
+  {
+    return reference(state_.get(),
+                     &base_(std::forward<ARGS>(args)...) - base_.data);
+  }
+
+#if defined(RAJA_ENABLE_ATOMIC_STATS)
+  // as AtomicViewWrapper, views of up to four dimensions pass the site of
+  // their caller on to the atomics
+  template <typename A0>
+  RAJA_INLINE reference operator()(A0 &&a0 RAJA_ATOMIC_SITE_PARAM) const
+  {
+    return reference(state_.get(),
+                     &base_(std::forward<A0>(a0)) - base_.data,
+                     atomic_site);
+  }
+
+  template <typename A0, typename A1>
+  RAJA_INLINE reference operator()(A0 &&a0,
+                                   A1 &&a1 RAJA_ATOMIC_SITE_PARAM) const
+  {
+    return reference(state_.get(),
+                     &base_(std::forward<A0>(a0), std::forward<A1>(a1))
+                         - base_.data,
+                     atomic_site);
+  }
+
+  template <typename A0, typename A1, typename A2>
+  RAJA_INLINE reference operator()(A0 &&a0,
+                                   A1 &&a1,
+                                   A2 &&a2 RAJA_ATOMIC_SITE_PARAM) const
+  {
+    return reference(state_.get(),
+                     &base_(std::forward<A0>(a0),
+                            std::forward<A1>(a1),
+                            std::forward<A2>(a2))
+                         - base_.data,
+                     atomic_site);
+  }
+
+  template <typename A0, typename A1, typename A2, typename A3>
+  RAJA_INLINE reference operator()(A0 &&a0,
+                                   A1 &&a1,
+                                   A2 &&a2,
+                                   A3 &&a3 RAJA_ATOMIC_SITE_PARAM) const
+  {
+    return reference(state_.get(),
+                     &base_(std::forward<A0>(a0),
+                            std::forward<A1>(a1),
+                            std::forward<A2>(a2),
+                            std::forward<A3>(a3))
+                         - base_.data,
+                     atomic_site);
+  }
+#endif
+
+  //! add the buffered updates to the target
+  void flush(RAJA_ATOMIC_SITE_DECL) const
+  {
+    state_->flush(seq_exec{} RAJA_ATOMIC_SITE_ARG(atomic_site));
+  }
+
+  //! add the buffered updates to the target using an execution policy
+  template <typename ExecPolicy>
+  void flush(ExecPolicy const &p RAJA_ATOMIC_SITE_PARAM) const
+  {
+    state_->flush(p RAJA_ATOMIC_SITE_ARG(atomic_site));
+  }
+
+private:
+  base_type base_;
+  std::shared_ptr<state_type> state_;
+};
+
+template <typename AtomicPolicy = RAJA::auto_atomic, typename ViewType>
+RAJA_INLINE ShardedAtomicView<ViewType, AtomicPolicy> make_sharded_atomic_view(
+    ViewType const &view RAJA_ATOMIC_SITE_PARAM)
+{
+  return ShardedAtomicView<ViewType, AtomicPolicy>(
+      view RAJA_ATOMIC_SITE_ARG(atomic_site));
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -20,6 +20,12 @@
 
 #include "RAJA/config.hpp"
 
+#include "camp/camp.hpp"
+
+#include "RAJA/internal/LegacyCompatibility.hpp"
+
+#include "RAJA/util/basic_mempool.hpp"
+
 // for RAJA::reduce::detail::ValueLoc
 #include "RAJA/pattern/detail/reduce.hpp"
 
@@ -72,6 +78,75 @@ private:
   value_type* mem = nullptr;
 };
 
+/*!
+ * @brief Specialization for camp::tuple, each component is allocated as its
+ *        own array.
+ *
+ * This lets multi-dimensional reduction locations stay in SoA form.
+ */
+template <typename... Ts, typename mempool>
+class SoAPtr< ::camp::tuple<Ts...>, mempool>
+{
+  using value_type = ::camp::tuple<Ts...>;
+  using seq_type = camp::make_idx_seq_t<sizeof...(Ts)>;
+
+public:
+  SoAPtr() = default;
+  explicit SoAPtr(size_t size) { allocate(size); }
+
+  SoAPtr& allocate(size_t size)
+  {
+    allocate_impl(size, seq_type{});
+    return *this;
+  }
+
+  SoAPtr& deallocate()
+  {
+    deallocate_impl(seq_type{});
+    return *this;
+  }
+
+  RAJA_HOST_DEVICE bool allocated() const
+  {
+    return camp::get<0>(mem).allocated();
+  }
+
+  RAJA_HOST_DEVICE value_type get(size_t i) const
+  {
+    return get_impl(i, seq_type{});
+  }
+  RAJA_HOST_DEVICE void set(size_t i, value_type val)
+  {
+    set_impl(i, val, seq_type{});
+  }
+
+private:
+  template <camp::idx_t... Is>
+  void allocate_impl(size_t size, camp::idx_seq<Is...>)
+  {
+    VarOps::ignore_args((camp::get<Is>(mem).allocate(size), 0)...);
+  }
+  template <camp::idx_t... Is>
+  void deallocate_impl(camp::idx_seq<Is...>)
+  {
+    VarOps::ignore_args((camp::get<Is>(mem).deallocate(), 0)...);
+  }
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE value_type get_impl(size_t i, camp::idx_seq<Is...>) const
+  {
+    return value_type(camp::get<Is>(mem).get(i)...);
+  }
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE void set_impl(size_t i,
+                                 value_type const& val,
+                                 camp::idx_seq<Is...>)
+  {
+    VarOps::ignore_args((camp::get<Is>(mem).set(i, camp::get<Is>(val)), 0)...);
+  }
+
+  ::camp::tuple<SoAPtr<Ts, mempool>...> mem;
+};
+
 /*!
  * @brief Specialization for RAJA::reduce::detail::ValueLoc.
  */
@@ -86,14 +161,14 @@ public:
   SoAPtr() = default;
   explicit SoAPtr(size_t size)
       : mem(mempool::getInstance().template malloc<first_type>(size)),
-        mem_idx(mempool::getInstance().template malloc<second_type>(size))
+        mem_idx(size)
   {
   }
 
   SoAPtr& allocate(size_t size)
   {
     mem = mempool::getInstance().template malloc<first_type>(size);
-    mem_idx = mempool::getInstance().template malloc<second_type>(size);
+    mem_idx.allocate(size);
     return *this;
   }
 
@@ -101,8 +176,7 @@ public:
   {
     mempool::getInstance().free(mem);
     mem = nullptr;
-    mempool::getInstance().free(mem_idx);
-    mem_idx = nullptr;
+    mem_idx.deallocate();
     return *this;
   }
 
@@ -110,17 +184,17 @@ public:
 
   RAJA_HOST_DEVICE value_type get(size_t i) const
   {
-    return value_type(mem[i], mem_idx[i]);
+    return value_type(mem[i], mem_idx.get(i));
   }
   RAJA_HOST_DEVICE void set(size_t i, value_type val)
   {
     mem[i] = val;
-    mem_idx[i] = val.getLoc();
+    mem_idx.set(i, val.getLoc());
   }
 
 private:
   first_type* mem = nullptr;
-  second_type* mem_idx = nullptr;
+  SoAPtr<second_type, mempool> mem_idx;
 };
 
 }  // namespace detail
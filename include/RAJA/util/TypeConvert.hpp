@@ -24,6 +24,8 @@
 
 #include "RAJA/config.hpp"
 
+#include <type_traits>
+
 #include "RAJA/util/macros.hpp"
 
 
@@ -33,6 +35,26 @@ namespace util
 {
 
 
+namespace detail
+{
+
+// class types such as ValueLoc cannot be copied from a volatile reference
+template <typename B>
+RAJA_INLINE RAJA_HOST_DEVICE constexpr B reinterp_read(B const volatile &val,
+                                                       std::true_type)
+{
+  return val;
+}
+
+template <typename B>
+RAJA_INLINE RAJA_HOST_DEVICE constexpr B reinterp_read(B const volatile &val,
+                                                       std::false_type)
+{
+  return const_cast<B const &>(val);
+}
+
+}  // namespace detail
+
 /*!
  * Reinterpret any datatype as another datatype of the same size
  */
@@ -40,14 +62,16 @@ template <typename A, typename B>
 RAJA_INLINE RAJA_HOST_DEVICE constexpr B reinterp_A_as_B(A const &val)
 {
   static_assert(sizeof(A) == sizeof(B), "A and B must be same size");
-  return reinterpret_cast<B const volatile &>(val);
+  return detail::reinterp_read(reinterpret_cast<B const volatile &>(val),
+                               std::is_scalar<B>{});
 }
 
 template <typename A, typename B>
 RAJA_INLINE RAJA_HOST_DEVICE constexpr B reinterp_A_as_B(A volatile const &val)
 {
   static_assert(sizeof(A) == sizeof(B), "A and B must be same size");
-  return reinterpret_cast<B const volatile &>(val);
+  return detail::reinterp_read(reinterpret_cast<B const volatile &>(val),
+                               std::is_scalar<B>{});
 }
 
 
@@ -176,6 +176,49 @@ struct AtomicViewWrapper {
   {
     return atomic_type(&base_.operator()(std::forward<ARGS>(args)...));
   }
+
+#if defined(RAJA_ENABLE_ATOMIC_STATS)
+  // Views of up to four dimensions pass the site of their caller to the
+  // AtomicRef; a parameter pack cannot be followed by a defaulted one.
+  template <typename A0>
+  RAJA_INLINE atomic_type operator()(A0 &&a0 RAJA_ATOMIC_SITE_PARAM) const
+  {
+    return atomic_type(&base_.operator()(std::forward<A0>(a0)), atomic_site);
+  }
+
+  template <typename A0, typename A1>
+  RAJA_INLINE atomic_type operator()(A0 &&a0,
+                                     A1 &&a1 RAJA_ATOMIC_SITE_PARAM) const
+  {
+    return atomic_type(&base_.operator()(std::forward<A0>(a0),
+                                         std::forward<A1>(a1)),
+                       atomic_site);
+  }
+
+  template <typename A0, typename A1, typename A2>
+  RAJA_INLINE atomic_type operator()(A0 &&a0,
+                                     A1 &&a1,
+                                     A2 &&a2 RAJA_ATOMIC_SITE_PARAM) const
+  {
+    return atomic_type(&base_.operator()(std::forward<A0>(a0),
+                                         std::forward<A1>(a1),
+                                         std::forward<A2>(a2)),
+                       atomic_site);
+  }
+
+  template <typename A0, typename A1, typename A2, typename A3>
+  RAJA_INLINE atomic_type operator()(A0 &&a0,
+                                     A1 &&a1,
+                                     A2 &&a2,
+                                     A3 &&a3 RAJA_ATOMIC_SITE_PARAM) const
+  {
+    return atomic_type(&base_.operator()(std::forward<A0>(a0),
+                                         std::forward<A1>(a1),
+                                         std::forward<A2>(a2),
+                                         std::forward<A3>(a3)),
+                       atomic_site);
+  }
+#endif
 };
 
 
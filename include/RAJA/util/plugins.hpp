@@ -38,6 +38,18 @@ callPostLaunchPlugins(PluginContext p) noexcept
   }
 }
 
+inline
+void
+callAtomicStatsPlugins(std::vector<AtomicSiteStats> const &stats) noexcept
+{
+  for (auto plugin = PluginRegistry::begin(); 
+      plugin != PluginRegistry::end();
+      ++plugin)
+  {
+    (*plugin).get()->atomicStats(stats);
+  }
+}
+
 } // closing brace for util namespace
 } // closing brace for RAJA namespace
 
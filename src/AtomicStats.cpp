@@ -0,0 +1,276 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the per call site atomic statistics.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/AtomicStats.hpp"
+
+#if defined(RAJA_ENABLE_ATOMIC_STATS)
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "RAJA/util/PluginStrategy.hpp"
+#include "RAJA/util/plugins.hpp"
+
+namespace RAJA
+{
+
+namespace
+{
+
+using util::AtomicSite;
+using util::AtomicSiteStats;
+
+struct SiteCounts {
+  const char *file = nullptr;
+  unsigned line = 0;
+  unsigned long long operations = 0;
+  unsigned long long retries = 0;
+};
+
+/*!
+ * One thread's counters, an open addressing table keyed by the address of
+ * the site's file name and its line, which is only written by its thread.
+ */
+class ThreadCounts
+{
+public:
+  ThreadCounts() : slots_(64) {}
+
+  SiteCounts *find(AtomicSite site)
+  {
+    const size_t mask = slots_.size() - 1;
+    size_t slot = hash(site) & mask;
+    while (slots_[slot].file != nullptr) {
+      if (slots_[slot].file == site.file && slots_[slot].line == site.line) {
+        return &slots_[slot];
+      }
+      slot = (slot + 1) & mask;
+    }
+    if (2 * (used_ + 1) > slots_.size()) {
+      grow();
+      return find(site);
+    }
+    ++used_;
+    slots_[slot].file = site.file;
+    slots_[slot].line = site.line;
+    return &slots_[slot];
+  }
+
+  std::vector<SiteCounts> const &slots() const { return slots_; }
+
+  void reset()
+  {
+    for (SiteCounts &counts : slots_) {
+      counts.operations = 0;
+      counts.retries = 0;
+    }
+  }
+
+private:
+  static size_t hash(AtomicSite site)
+  {
+    const std::uint64_t key =
+        reinterpret_cast<std::uintptr_t>(site.file) ^ site.line;
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32);
+  }
+
+  void grow()
+  {
+    std::vector<SiteCounts> old(2 * slots_.size());
+    old.swap(slots_);
+    const size_t mask = slots_.size() - 1;
+    for (SiteCounts const &counts : old) {
+      if (counts.file == nullptr) continue;
+      size_t slot = hash(AtomicSite{counts.file, counts.line}) & mask;
+      while (slots_[slot].file != nullptr) {
+        slot = (slot + 1) & mask;
+      }
+      slots_[slot] = counts;
+    }
+  }
+
+  std::vector<SiteCounts> slots_;
+  size_t used_ = 0;
+};
+
+/*!
+ * The counters of every thread that has performed an atomic.  They outlive
+ * their threads, so the counts of finished threads are kept, and are
+ * reported to the plugins when the program ends.
+ */
+class AtomicStatsStore
+{
+public:
+  ~AtomicStatsStore()
+  {
+    std::vector<AtomicSiteStats> stats = collect();
+    finished() = true;
+    if (!stats.empty()) {
+      util::callAtomicStatsPlugins(stats);
+    }
+  }
+
+  ThreadCounts *add_thread()
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    threads_.emplace_back(new ThreadCounts);
+    return threads_.back().get();
+  }
+
+  std::vector<AtomicSiteStats> collect()
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    // sites are merged by file name, whose address may differ between
+    // translation units
+    std::map<std::pair<std::string, unsigned>,
+             std::pair<unsigned long long, unsigned long long>>
+        merged;
+    for (auto const &thread : threads_) {
+      for (SiteCounts const &counts : thread->slots()) {
+        if (counts.file == nullptr || counts.operations == 0) continue;
+        auto &total = merged[std::make_pair(std::string(counts.file),
+                                            counts.line)];
+        total.first += counts.operations;
+        total.second += counts.retries;
+      }
+    }
+
+    std::vector<AtomicSiteStats> stats;
+    for (auto const &site : merged) {
+      stats.push_back(AtomicSiteStats{site.first.first,
+                                      site.first.second,
+                                      site.second.first,
+                                      site.second.second});
+    }
+    std::stable_sort(stats.begin(),
+                     stats.end(),
+                     [](AtomicSiteStats const &a, AtomicSiteStats const &b) {
+                       return a.retries != b.retries
+                                  ? a.retries > b.retries
+                                  : a.operations > b.operations;
+                     });
+    return stats;
+  }
+
+  void reset()
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto const &thread : threads_) {
+      thread->reset();
+    }
+  }
+
+  //! set once the store is destroyed, after which nothing is counted
+  static bool &finished()
+  {
+    static bool done = false;
+    return done;
+  }
+
+private:
+  std::mutex lock_;
+  std::vector<std::unique_ptr<ThreadCounts>> threads_;
+};
+
+AtomicStatsStore &store()
+{
+  static AtomicStatsStore the_store;
+  return the_store;
+}
+
+thread_local ThreadCounts *thread_counts = nullptr;
+thread_local SiteCounts *current_site = nullptr;
+
+/*!
+ * Plugin printing the statistics to stderr at program end, busiest sites
+ * first.
+ */
+class AtomicStatsPrinter : public util::PluginStrategy
+{
+public:
+  void preLaunch(util::PluginContext) override {}
+
+  void postLaunch(util::PluginContext) override {}
+
+  void atomicStats(std::vector<AtomicSiteStats> const &stats) override
+  {
+    std::fprintf(stderr,
+                 "RAJA atomic statistics\n%20s %20s %10s  %s\n",
+                 "operations",
+                 "CAS retries",
+                 "retries/op",
+                 "call site");
+    for (AtomicSiteStats const &site : stats) {
+      std::fprintf(stderr,
+                   "%20llu %20llu %10.3f  %s:%u\n",
+                   site.operations,
+                   site.retries,
+                   static_cast<double>(site.retries)
+                       / static_cast<double>(site.operations),
+                   site.file.c_str(),
+                   site.line);
+    }
+  }
+};
+
+util::PluginRegistry::Add<AtomicStatsPrinter> atomic_stats_printer(
+    "atomic-stats",
+    "Prints atomic operations and CAS retries per call site");
+
+}  // namespace
+
+namespace util
+{
+
+std::vector<AtomicSiteStats> getAtomicStats() { return store().collect(); }
+
+void resetAtomicStats() { store().reset(); }
+
+}  // namespace util
+
+namespace detail
+{
+
+void atomic_stats_begin(AtomicSite site)
+{
+  if (AtomicStatsStore::finished()) return;
+  if (thread_counts == nullptr) {
+    thread_counts = store().add_thread();
+  }
+  current_site = thread_counts->find(site);
+  ++current_site->operations;
+}
+
+void atomic_stats_end() { current_site = nullptr; }
+
+void atomic_stats_retry()
+{
+  if (current_site != nullptr) {
+    ++current_site->retries;
+  }
+}
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // RAJA_ENABLE_ATOMIC_STATS
@@ -0,0 +1,188 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA CPU compaction, partition, unique
+/// and run-length encoding operations.
+///
+
+#include <algorithm>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+const int N = 20000;
+
+template <typename ExecPolicy>
+class Compact : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(Compact);
+
+struct IsActive {
+  bool operator()(int v) const { return (v * 7919) % 13 < 4; }
+};
+
+static std::vector<int> make_data()
+{
+  std::vector<int> data(N);
+  for (int i = 0; i < N; ++i) {
+    data[i] = (i * 31) % 1000 - 500;
+  }
+  return data;
+}
+
+TYPED_TEST_P(Compact, CopyIf)
+{
+  std::vector<int> in = make_data();
+  std::vector<int> out(N, -1);
+
+  RAJA::Index_type count =
+      RAJA::copy_if(TypeParam(), in.begin(), in.end(), out.begin(), IsActive{});
+
+  std::vector<int> expected;
+  std::copy_if(in.begin(), in.end(), std::back_inserter(expected), IsActive{});
+  ASSERT_EQ(static_cast<RAJA::Index_type>(expected.size()), count);
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+
+  ASSERT_EQ(0,
+            RAJA::copy_if(
+                TypeParam(), in.data(), in.data(), out.data(), IsActive{}));
+}
+
+TYPED_TEST_P(Compact, CopyIfIndices)
+{
+  // build a list of active indices, as for a ListSegment
+  std::vector<int> in = make_data();
+  const int* data = in.data();
+  RAJA::RangeSegment range(0, N);
+  std::vector<RAJA::Index_type> active(N);
+
+  RAJA::Index_type count =
+      RAJA::copy_if(TypeParam(),
+                    range.begin(),
+                    range.end(),
+                    active.begin(),
+                    [=](RAJA::Index_type i) { return data[i] > 250; });
+
+  std::vector<RAJA::Index_type> expected;
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    if (data[i] > 250) expected.push_back(i);
+  }
+  ASSERT_EQ(static_cast<RAJA::Index_type>(expected.size()), count);
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), active.begin()));
+}
+
+TYPED_TEST_P(Compact, RemoveIf)
+{
+  std::vector<int> data = make_data();
+  std::vector<int> expected = data;
+  expected.erase(std::remove_if(expected.begin(), expected.end(), IsActive{}),
+                 expected.end());
+
+  RAJA::Index_type count = RAJA::remove_if(TypeParam(), data, IsActive{});
+
+  ASSERT_EQ(static_cast<RAJA::Index_type>(expected.size()), count);
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), data.begin()));
+}
+
+TYPED_TEST_P(Compact, Partition)
+{
+  std::vector<int> data = make_data();
+  std::vector<int> expected = data;
+  auto mid =
+      std::stable_partition(expected.begin(), expected.end(), IsActive{});
+
+  RAJA::Index_type count =
+      RAJA::stable_partition(TypeParam(), data.begin(), data.end(), IsActive{});
+
+  ASSERT_EQ(mid - expected.begin(), count);
+  ASSERT_EQ(expected, data);
+
+  data = make_data();
+  count = RAJA::partition(TypeParam(), data, IsActive{});
+  ASSERT_EQ(mid - expected.begin(), count);
+  ASSERT_TRUE(std::all_of(data.begin(), data.begin() + count, IsActive{}));
+  ASSERT_TRUE(std::none_of(data.begin() + count, data.end(), IsActive{}));
+}
+
+TYPED_TEST_P(Compact, Unique)
+{
+  // sorted node ids gathered from elements, with repeats
+  std::vector<int> nodes(N);
+  for (int i = 0; i < N; ++i) {
+    nodes[i] = i / 4 + (i % 4 == 3);
+  }
+  std::vector<int> expected = nodes;
+  expected.erase(std::unique(expected.begin(), expected.end()),
+                 expected.end());
+
+  std::vector<int> out(N, -1);
+  RAJA::Index_type count =
+      RAJA::unique_copy(TypeParam(), nodes.begin(), nodes.end(), out.begin());
+  ASSERT_EQ(static_cast<RAJA::Index_type>(expected.size()), count);
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+
+  count = RAJA::unique(TypeParam(), nodes);
+  ASSERT_EQ(static_cast<RAJA::Index_type>(expected.size()), count);
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), nodes.begin()));
+
+  ASSERT_EQ(0, RAJA::unique(TypeParam(), nodes.data(), nodes.data()));
+  ASSERT_EQ(1, RAJA::unique(TypeParam(), nodes.data(), nodes.data() + 1));
+}
+
+TYPED_TEST_P(Compact, RunLengthEncode)
+{
+  std::vector<int> in = make_data();
+  std::sort(in.begin(), in.end());
+
+  std::vector<int> expected_values;
+  std::vector<long> expected_counts;
+  for (int i = 0; i < N; ++i) {
+    if (i == 0 || in[i] != in[i - 1]) {
+      expected_values.push_back(in[i]);
+      expected_counts.push_back(0);
+    }
+    ++expected_counts.back();
+  }
+
+  std::vector<int> values(N, -1);
+  std::vector<long> counts(N, -1);
+  RAJA::Index_type runs = RAJA::run_length_encode(
+      TypeParam(), in.begin(), in.end(), values.data(), counts.begin());
+
+  ASSERT_EQ(static_cast<RAJA::Index_type>(expected_values.size()), runs);
+  ASSERT_TRUE(std::equal(
+      expected_values.begin(), expected_values.end(), values.begin()));
+  ASSERT_TRUE(std::equal(
+      expected_counts.begin(), expected_counts.end(), counts.begin()));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(Compact,
+                           CopyIf,
+                           CopyIfIndices,
+                           RemoveIf,
+                           Partition,
+                           Unique,
+                           RunLengthEncode);
+
+using CompactTypes = ::testing::Types<RAJA::seq_exec,
+                                      RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                      ,
+                                      RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                      ,
+                                      RAJA::tbb_for_exec
+#endif
+                                      >;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(CompactTests, Compact, CompactTypes);
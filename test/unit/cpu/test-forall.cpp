@@ -127,3 +127,182 @@ using TBBTypes = ::testing::Types<ExecPolicy<seq_segit, tbb_for_exec>,
 
 INSTANTIATE_TYPED_TEST_SUITE_P(TBB, ForallTest, TBBTypes);
 #endif
+
+
+template <typename EXEC_POLICY_T>
+class ForallParamTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(ForallParamTest);
+
+TYPED_TEST_P(ForallParamTest, SumMinMax)
+{
+  using ExecPolicy = TypeParam;
+
+  const Index_type N = 10007;
+  double* a = new double[N];
+  for (Index_type i = 0; i < N; ++i) {
+    a[i] = double((i * 7919) % N) - 5000.0;
+  }
+
+  double sum = 10.0;
+  double vmin = 0.0;
+  double vmax = 0.0;
+  long count = 0;
+
+  RAJA::forall_param<ExecPolicy>(
+      RAJA::RangeSegment(0, N),
+      RAJA::make_tuple(RAJA::reduce_sum(&sum),
+                       RAJA::reduce_min(&vmin),
+                       RAJA::reduce_max(&vmax),
+                       RAJA::reduce_sum(&count)),
+      [=](Index_type i, double& s, double& lo, double& hi, long& c) {
+        s += a[i];
+        lo = RAJA_MIN(lo, a[i]);
+        hi = RAJA_MAX(hi, a[i]);
+        c += 1;
+      });
+
+  double ref_sum = 10.0;
+  for (Index_type i = 0; i < N; ++i) {
+    ref_sum += a[i];
+  }
+
+  ASSERT_DOUBLE_EQ(sum, ref_sum);
+  ASSERT_EQ(vmin, -5000.0);
+  ASSERT_EQ(vmax, double(N - 1) - 5000.0);
+  ASSERT_EQ(count, N);
+
+  // a second loop accumulates on top of the first
+  RAJA::forall_param<ExecPolicy>(RAJA::RangeSegment(0, N),
+                                 RAJA::make_tuple(RAJA::reduce_sum(&count)),
+                                 [=](Index_type, long& c) { c += 2; });
+
+  ASSERT_EQ(count, 3 * N);
+
+  delete[] a;
+}
+
+TYPED_TEST_P(ForallParamTest, EmptyRange)
+{
+  using ExecPolicy = TypeParam;
+
+  int sum = 3;
+  int vmax = 4;
+
+  RAJA::forall_param<ExecPolicy>(
+      RAJA::RangeSegment(0, 0),
+      RAJA::make_tuple(RAJA::reduce_sum(&sum), RAJA::reduce_max(&vmax)),
+      [=](Index_type i, int& s, int& m) {
+        s += 1;
+        m = RAJA_MAX(m, int(i));
+      });
+
+  ASSERT_EQ(sum, 3);
+  ASSERT_EQ(vmax, 4);
+}
+
+TYPED_TEST_P(ForallParamTest, MatchesSeqReduce)
+{
+  using ExecPolicy = TypeParam;
+
+  const Index_type N = 5003;
+  double* a = new double[N];
+  for (Index_type i = 0; i < N; ++i) {
+    // few distinct values, so the min and max are tied many times over
+    a[i] = double((i * 37) % 101) * 0.5;
+  }
+
+  RAJA::ReduceSum<RAJA::seq_reduce, double> ref_sum(1.0);
+  RAJA::ReduceMin<RAJA::seq_reduce, double> ref_min(1.0e10);
+  RAJA::ReduceMax<RAJA::seq_reduce, double> ref_max(-1.0e10);
+  RAJA::ReduceMinLoc<RAJA::seq_reduce, double> ref_minloc(1.0e10, -1);
+  RAJA::ReduceMaxLoc<RAJA::seq_reduce, double> ref_maxloc(-1.0e10, -1);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N), [=](Index_type i) {
+    ref_sum += a[i];
+    ref_min.min(a[i]);
+    ref_max.max(a[i]);
+    ref_minloc.minloc(a[i], i);
+    ref_maxloc.maxloc(a[i], i);
+  });
+
+  double sum = 1.0;
+  double vmin = 1.0e10;
+  double vmax = -1.0e10;
+  double vminloc = 1.0e10;
+  double vmaxloc = -1.0e10;
+  Index_type minloc = -1;
+  Index_type maxloc = -1;
+
+  RAJA::forall_param<ExecPolicy>(
+      RAJA::RangeSegment(0, N),
+      RAJA::make_tuple(RAJA::reduce_sum(&sum),
+                       RAJA::reduce_min(&vmin),
+                       RAJA::reduce_max(&vmax),
+                       RAJA::reduce_minloc(&vminloc, &minloc),
+                       RAJA::reduce_maxloc(&vmaxloc, &maxloc)),
+      [=](Index_type i,
+          double& s,
+          double& lo,
+          double& hi,
+          RAJA::MinLocValue<double>& lo_loc,
+          RAJA::MaxLocValue<double>& hi_loc) {
+        s += a[i];
+        lo = RAJA_MIN(lo, a[i]);
+        hi = RAJA_MAX(hi, a[i]);
+        lo_loc.minloc(a[i], i);
+        hi_loc.maxloc(a[i], i);
+      });
+
+  ASSERT_DOUBLE_EQ(sum, ref_sum.get());
+  ASSERT_EQ(vmin, ref_min.get());
+  ASSERT_EQ(vmax, ref_max.get());
+  ASSERT_EQ(vminloc, ref_minloc.get());
+  ASSERT_EQ(minloc, ref_minloc.getLoc());
+  ASSERT_EQ(vmaxloc, ref_maxloc.get());
+  ASSERT_EQ(maxloc, ref_maxloc.getLoc());
+
+  delete[] a;
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallParamTest,
+                            SumMinMax,
+                            EmptyRange,
+                            MatchesSeqReduce);
+
+using SequentialParamTypes = ::testing::Types<seq_exec, loop_exec, simd_exec>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(Sequential,
+                               ForallParamTest,
+                               SequentialParamTypes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+using OpenMPParamTypes =
+    ::testing::Types<omp_parallel_for_exec,
+                     omp_parallel_exec<omp_for_nowait_exec>>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(OpenMP, ForallParamTest, OpenMPParamTypes);
+
+TEST(ForallParamOpenMP, ForInsideRegion)
+{
+  const Index_type N = 1000;
+  long sum = 0;
+
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    RAJA::forall_param<RAJA::omp_for_exec>(
+        RAJA::RangeSegment(0, N),
+        RAJA::make_tuple(RAJA::reduce_sum(&sum)),
+        [=](Index_type i, long& s) { s += i; });
+  });
+
+  ASSERT_EQ(sum, N * (N - 1) / 2);
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+using TBBParamTypes = ::testing::Types<tbb_for_exec, tbb_for_dynamic>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(TBB, ForallParamTest, TBBParamTypes);
+#endif
@@ -14,8 +14,13 @@
 #include <iostream>
 #include "RAJA/RAJA.hpp"
 #include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/util/SoAArray.hpp"
+#include "RAJA/util/SoAPtr.hpp"
 
+#include <algorithm>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include <math.h>
 
@@ -706,6 +711,45 @@ TYPED_TEST_P(ReductionGenericLocTest, ReduceMaxLoc2DIndexTupleViewKernel)
   ASSERT_EQ(this->maxlocy, RAJA::get<1>(raja_loc));
 }
 
+TYPED_TEST_P(ReductionGenericLocTest, ReduceMinMaxLoc2DTupleKernelArgs)
+{
+  using ExecPolicy =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::loop_exec,  // row
+        RAJA::statement::For<0, RAJA::loop_exec,  // col
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >;
+
+  using ReducePolicy = typename std::tuple_element<1, TypeParam>::type;
+  using LocType = RAJA::tuple<int, int>;
+
+  RAJA::RangeSegment colrange(0, 10);
+  RAJA::RangeSegment rowrange(0, 10);
+
+  RAJA::View<double, RAJA::Layout<2>> ArrView(this->data, 10, 10);
+
+  RAJA::ReduceMinLoc<ReducePolicy, double, LocType> minloc_reducer(1024.0, LocType(0, 0));
+  RAJA::ReduceMaxLoc<ReducePolicy, double, LocType> maxloc_reducer(-1024.0, LocType(0, 0));
+
+  RAJA::kernel<ExecPolicy>(RAJA::make_tuple(colrange, rowrange),
+                           [=](int c, int r) {
+                             minloc_reducer.minloc(ArrView(r, c), c, r);
+                             maxloc_reducer.maxloc(ArrView(r, c), c, r);
+                           });
+
+  LocType raja_minloc = minloc_reducer.getLoc();
+  LocType raja_maxloc = maxloc_reducer.getLoc();
+
+  ASSERT_FLOAT_EQ(this->min, (double)minloc_reducer.get());
+  ASSERT_EQ(this->minlocx, RAJA::get<0>(raja_minloc));
+  ASSERT_EQ(this->minlocy, RAJA::get<1>(raja_minloc));
+  ASSERT_FLOAT_EQ(this->max, (double)maxloc_reducer.get());
+  ASSERT_EQ(this->maxlocx, RAJA::get<0>(raja_maxloc));
+  ASSERT_EQ(this->maxlocy, RAJA::get<1>(raja_maxloc));
+}
+
 TYPED_TEST_P(ReductionCorrectnessTest, ReduceMinLoc2)
 {
   using ExecPolicy =
@@ -857,6 +901,148 @@ TYPED_TEST_P(ReductionCorrectnessTest, ReduceMaxLocGenericIndex2)
   ASSERT_EQ(this->maxloc, raja_loc.idx);
 }
 
+TYPED_TEST_P(ReductionCorrectnessTest, ReduceProd)
+{
+  using ExecPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using ReducePolicy = typename std::tuple_element<1, TypeParam>::type;
+
+  RAJA::ReduceProd<ReducePolicy, double> prod_reducer(1.0);
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, this->array_length),
+                           [=](int i) { prod_reducer *= (i % 3 == 0) ? 2.0 : 1.0; });
+
+  double prod = 1.0;
+  for (int i = 0; i < this->array_length; ++i) {
+    prod *= (i % 3 == 0) ? 2.0 : 1.0;
+  }
+
+  ASSERT_FLOAT_EQ(prod, (double)prod_reducer.get());
+
+  RAJA::ReduceProd<ReducePolicy, double> default_reducer;
+  ASSERT_FLOAT_EQ(1.0, (double)default_reducer.get());
+}
+
+TYPED_TEST_P(ReductionCorrectnessTest, ReduceBitOrAnd)
+{
+  using ExecPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using ReducePolicy = typename std::tuple_element<1, TypeParam>::type;
+
+  RAJA::ReduceBitOr<ReducePolicy, int> or_reducer(0);
+  RAJA::ReduceBitAnd<ReducePolicy, int> and_reducer;
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, this->array_length),
+                           [=](int i) {
+                             or_reducer |= 1 << (i % 8);
+                             and_reducer &= (i == 5) ? ~4 : ~0;
+                           });
+
+  ASSERT_EQ(0xFF, (int)or_reducer.get());
+  ASSERT_EQ(~4, (int)and_reducer.get());
+}
+
+TYPED_TEST_P(ReductionCorrectnessTest, ReduceLogical)
+{
+  using ExecPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using ReducePolicy = typename std::tuple_element<1, TypeParam>::type;
+
+  RAJA::ReduceLogicalOr<ReducePolicy, bool> any_negative(false);
+  RAJA::ReduceLogicalAnd<ReducePolicy, bool> all_positive(true);
+  RAJA::ReduceLogicalAnd<ReducePolicy, bool> all_bounded;
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, this->array_length),
+                           [=](int i) {
+                             any_negative.logical_or(this->array[i] < 0.0);
+                             all_positive.logical_and(this->array[i] > 0.0);
+                             all_bounded.logical_and(this->array[i] >= -1.0);
+                           });
+
+  ASSERT_TRUE(any_negative.get());
+  ASSERT_FALSE(all_positive.get());
+  ASSERT_TRUE(all_bounded.get());
+}
+
+TYPED_TEST_P(ReductionCorrectnessTest, ReduceGenericOp)
+{
+  using ExecPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using ReducePolicy = typename std::tuple_element<1, TypeParam>::type;
+
+  RAJA::Reduce<ReducePolicy, int, RAJA::operators::bit_xor<int>> xor_reducer(0);
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, this->array_length),
+                           [=](int i) { xor_reducer.reduce(i * 7); });
+
+  int parity = 0;
+  for (int i = 0; i < this->array_length; ++i) {
+    parity ^= i * 7;
+  }
+
+  ASSERT_EQ(parity, (int)xor_reducer.get());
+}
+
+TYPED_TEST_P(ReductionCorrectnessTest, ReduceMinMaxK)
+{
+  using ExecPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using ReducePolicy = typename std::tuple_element<1, TypeParam>::type;
+
+  constexpr size_t K = 5;
+  RAJA::ReduceMinK<ReducePolicy, int, int, K> mink_reducer;
+  RAJA::ReduceMaxK<ReducePolicy, int, int, K> maxk_reducer;
+
+  // few distinct values, so the K best entries include ties
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, this->array_length),
+                           [=](int i) {
+                             mink_reducer.minloc((i * 7919) % 50, i);
+                             maxk_reducer.maxloc((i * 7919) % 50, i);
+                           });
+
+  std::vector<std::pair<int, int>> ascending, descending;
+  for (int i = 0; i < this->array_length; ++i) {
+    ascending.emplace_back((i * 7919) % 50, i);
+    descending.emplace_back(-((i * 7919) % 50), i);
+  }
+  std::sort(ascending.begin(), ascending.end());
+  std::sort(descending.begin(), descending.end());
+
+  auto mins = mink_reducer.get();
+  auto maxs = maxk_reducer.get();
+  ASSERT_EQ(K, mins.size());
+  ASSERT_EQ(K, maxs.size());
+  for (size_t j = 0; j < K; ++j) {
+    ASSERT_EQ(ascending[j].first, mins.value(j));
+    ASSERT_EQ(ascending[j].second, mins.getLoc(j));
+    ASSERT_EQ(-descending[j].first, maxs.value(j));
+    ASSERT_EQ(descending[j].second, maxs.getLoc(j));
+  }
+
+  RAJA::ReduceMinK<ReducePolicy, int, int, K> few_reducer;
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, 3),
+                           [=](int i) { few_reducer.minloc(10 - i, i); });
+  auto few = few_reducer.get();
+  ASSERT_EQ(3u, few.size());
+  ASSERT_EQ(8, few[0].val);
+  ASSERT_EQ(2, few[0].getLoc());
+}
+
+TYPED_TEST_P(ReductionCorrectnessTest, ReduceRepeatedConstruction)
+{
+  using ExecPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using ReducePolicy = typename std::tuple_element<1, TypeParam>::type;
+
+  // reducers of the same value type share recycled storage; alternate
+  // operators so stale values from a previous reducer would be caught
+  for (int iter = 0; iter < 50; ++iter) {
+    RAJA::ReduceSum<ReducePolicy, double> sum_reducer(0.0);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, this->array_length),
+                             [=](int i) { sum_reducer += this->array[i]; });
+    ASSERT_FLOAT_EQ(this->sum, (double)sum_reducer.get());
+
+    RAJA::ReduceMax<ReducePolicy, double> max_reducer(-1024.0);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, iter + 1),
+                             [=](int i) { max_reducer.max(-this->array[i]); });
+    ASSERT_FLOAT_EQ(0.0, (double)max_reducer.get());
+  }
+}
+
 REGISTER_TYPED_TEST_SUITE_P(ReductionCorrectnessTest,
                            ReduceSum,
                            ReduceSum2,
@@ -871,7 +1057,13 @@ REGISTER_TYPED_TEST_SUITE_P(ReductionCorrectnessTest,
                            ReduceMaxLoc,
                            ReduceMaxLocGenericIndex,
                            ReduceMaxLoc2,
-                           ReduceMaxLocGenericIndex2);
+                           ReduceMaxLocGenericIndex2,
+                           ReduceProd,
+                           ReduceBitOrAnd,
+                           ReduceLogical,
+                           ReduceGenericOp,
+                           ReduceMinMaxK,
+                           ReduceRepeatedConstruction);
 
 REGISTER_TYPED_TEST_SUITE_P(ReductionGenericLocTest,
                            ReduceMinLoc2DIndex,
@@ -881,7 +1073,8 @@ REGISTER_TYPED_TEST_SUITE_P(ReductionGenericLocTest,
                            ReduceMaxLoc2DIndex,
                            ReduceMaxLoc2DIndexKernel,
                            ReduceMaxLoc2DIndexViewKernel,
-                           ReduceMaxLoc2DIndexTupleViewKernel);
+                           ReduceMaxLoc2DIndexTupleViewKernel,
+                           ReduceMinMaxLoc2DTupleKernelArgs);
 
 using types = ::testing::Types<
     std::tuple<RAJA::seq_exec, RAJA::seq_reduce>,
@@ -900,5 +1093,42 @@ using types = ::testing::Types<
 INSTANTIATE_TYPED_TEST_SUITE_P(Reduce, ReductionCorrectnessTest, types);
 INSTANTIATE_TYPED_TEST_SUITE_P(Reduce, ReductionGenericLocTest, types);
 
+TEST(ReductionTupleLoc, DefaultLocIsPerComponent)
+{
+  using LocType = RAJA::tuple<int, RAJA::Index_type>;
+  using ValLoc = RAJA::reduce::detail::ValueLoc<double, LocType>;
+
+  ValLoc identity;
+  ASSERT_EQ(-1, RAJA::get<0>(identity.getLoc()));
+  ASSERT_EQ(-1, RAJA::get<1>(identity.getLoc()));
+}
+
+TEST(ReductionTupleLoc, SoAStorage)
+{
+  using LocType = RAJA::tuple<int, int, int>;
+  using ValLoc = RAJA::reduce::detail::ValueLoc<double, LocType>;
+
+  RAJA::detail::SoAArray<ValLoc, 4> arr;
+  RAJA::detail::SoAPtr<ValLoc> ptr(4);
+
+  for (int i = 0; i < 4; ++i) {
+    arr.set(i, ValLoc(0.5 * i, LocType(i, 2 * i, 3 * i)));
+    ptr.set(i, ValLoc(0.5 * i, LocType(i, 2 * i, 3 * i)));
+  }
 
+  for (int i = 0; i < 4; ++i) {
+    ValLoc a = arr.get(i);
+    ValLoc p = ptr.get(i);
+    ASSERT_EQ(0.5 * i, (double)a);
+    ASSERT_EQ(0.5 * i, (double)p);
+    ASSERT_EQ(i, RAJA::get<0>(a.getLoc()));
+    ASSERT_EQ(2 * i, RAJA::get<1>(a.getLoc()));
+    ASSERT_EQ(3 * i, RAJA::get<2>(a.getLoc()));
+    ASSERT_EQ(i, RAJA::get<0>(p.getLoc()));
+    ASSERT_EQ(2 * i, RAJA::get<1>(p.getLoc()));
+    ASSERT_EQ(3 * i, RAJA::get<2>(p.getLoc()));
+  }
 
+  ptr.deallocate();
+  ASSERT_FALSE(ptr.allocated());
+}
@@ -10,9 +10,11 @@
 ///
 
 #include <algorithm>
+#include <atomic>
 #include <numeric>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include <cstdlib>
 
@@ -25,7 +27,9 @@ const int N = 32000;
 
 // Unit Test Space Exploration
 
-using ExecTypes = std::tuple<RAJA::seq_exec
+using ExecTypes = std::tuple<RAJA::seq_exec,
+                             RAJA::loop_exec,
+                             RAJA::simd_exec
 #if defined(RAJA_ENABLE_OPENMP)
                              ,
                              RAJA::omp_parallel_for_exec
@@ -40,6 +44,7 @@ using ReduceTypes = std::tuple<RAJA::operators::plus<int>,
                                RAJA::operators::plus<double>,
                                RAJA::operators::minimum<float>,
                                RAJA::operators::minimum<double>,
+                               RAJA::operators::minimum<long>,
                                RAJA::operators::maximum<int>,
                                RAJA::operators::maximum<float>>;
 
@@ -205,12 +210,383 @@ TYPED_TEST_P(Scan, exclusive_inplace_offset)
   delete[] data;
 }
 
+TYPED_TEST_P(Scan, short_ranges)
+{
+  using T = typename Info<TypeParam>::data_type;
+  using Function = typename Info<TypeParam>::function;
+
+  // lengths that are not a multiple of any vector width
+  const T* in = Scan<TypeParam>::data;
+  std::vector<T> out(70);
+  for (int n = 1; n < 70; n += 3) {
+    RAJA::inclusive_scan(
+        typename Info<TypeParam>::exec(), in, in + n, out.data(), Function{});
+    T agg = Function::identity();
+    for (int i = 0; i < n; ++i) {
+      agg = Function()(agg, in[i]);
+      ASSERT_EQ(agg, out[i]) << "length " << n << ", index " << i;
+    }
+
+    RAJA::exclusive_scan(typename Info<TypeParam>::exec(),
+                         in,
+                         in + n,
+                         out.data(),
+                         Function{},
+                         T(2));
+    agg = T(2);
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(agg, out[i]) << "length " << n << ", index " << i;
+      agg = Function()(agg, in[i]);
+    }
+  }
+}
+
 REGISTER_TYPED_TEST_SUITE_P(Scan,
                            inclusive,
                            inclusive_inplace,
                            exclusive,
                            exclusive_inplace,
                            exclusive_offset,
-                           exclusive_inplace_offset);
+                           exclusive_inplace_offset,
+                           short_ranges);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(ScanTests, Scan, CrossTypes);
+
+template <typename Tuple>
+struct SegmentedScan : public ::testing::Test {
+};
+
+TYPED_TEST_SUITE_P(SegmentedScan);
+
+//! segments of growing length with empty segments in between
+static std::vector<int> make_segment_offsets()
+{
+  std::vector<int> offsets{0, 0};
+  for (int len = 1; offsets.back() + len <= N; len = len * 3 + 1) {
+    offsets.push_back(offsets.back() + len);
+    offsets.push_back(offsets.back());
+  }
+  offsets.push_back(N);
+  return offsets;
+}
+
+template <typename Function, typename T>
+::testing::AssertionResult check_segmented(const T* actual,
+                                           const T* original,
+                                           const std::vector<char>& heads,
+                                           bool exclusive,
+                                           T init = Function::identity())
+{
+  T agg = init;
+  for (int i = 0; i < N; ++i) {
+    if (i == 0 || heads[i]) agg = init;
+    const T expected = exclusive ? agg : Function()(agg, original[i]);
+    if (actual[i] != expected)
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected << " (at index " << i << ")";
+    agg = Function()(agg, original[i]);
+  }
+  return ::testing::AssertionSuccess();
+}
+
+TYPED_TEST_P(SegmentedScan, flags)
+{
+  using T = typename Info<TypeParam>::data_type;
+  using Function = typename Info<TypeParam>::function;
+  using Exec = typename Info<TypeParam>::exec;
+
+  std::vector<T> in(N);
+  std::vector<char> heads(N, 0);
+  for (int i = 0; i < N; ++i) {
+    in[i] = static_cast<T>((i * 7919) % 1000);
+  }
+  for (int i = 1; i < N; i = i * 2 + 3) {
+    heads[i] = 1;
+  }
+
+  std::vector<T> out(N);
+  RAJA::inclusive_segmented_scan(
+      Exec(), in.begin(), in.end(), heads.begin(), out.begin(), Function{});
+  ASSERT_TRUE(check_segmented<Function>(out.data(), in.data(), heads, false));
+
+  RAJA::exclusive_segmented_scan(
+      Exec(), in.data(), in.data() + N, heads.data(), out.data(), Function{});
+  ASSERT_TRUE(check_segmented<Function>(out.data(), in.data(), heads, true));
+
+  RAJA::exclusive_segmented_scan(Exec(),
+                                 in.data(),
+                                 in.data() + N,
+                                 heads.data(),
+                                 out.data(),
+                                 Function{},
+                                 T(2));
+  ASSERT_TRUE(
+      check_segmented<Function>(out.data(), in.data(), heads, true, T(2)));
+
+  std::vector<T> data(in);
+  RAJA::inclusive_segmented_scan(Exec(),
+                                 data.data(),
+                                 data.data() + N,
+                                 heads.data(),
+                                 data.data(),
+                                 Function{});
+  ASSERT_TRUE(check_segmented<Function>(data.data(), in.data(), heads, false));
+}
+
+TYPED_TEST_P(SegmentedScan, offsets)
+{
+  using T = typename Info<TypeParam>::data_type;
+  using Function = typename Info<TypeParam>::function;
+  using Exec = typename Info<TypeParam>::exec;
+
+  std::vector<int> offsets = make_segment_offsets();
+  const RAJA::Index_type nsegs = offsets.size() - 1;
+  std::vector<char> heads(N, 0);
+  for (RAJA::Index_type s = 0; s < nsegs; ++s) {
+    if (offsets[s] < N) heads[offsets[s]] = 1;
+  }
+
+  std::vector<T> in(N);
+  for (int i = 0; i < N; ++i) {
+    in[i] = static_cast<T>((i * 7919) % 1000);
+  }
+
+  std::vector<T> out(N);
+  RAJA::inclusive_segmented_scan(
+      Exec(), in.data(), offsets.data(), nsegs, out.data(), Function{});
+  ASSERT_TRUE(check_segmented<Function>(out.data(), in.data(), heads, false));
+
+  RAJA::exclusive_segmented_scan(
+      Exec(), in.data(), offsets.data(), nsegs, out.data(), Function{}, T(2));
+  ASSERT_TRUE(
+      check_segmented<Function>(out.data(), in.data(), heads, true, T(2)));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SegmentedScan, flags, offsets);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(SegmentedScanTests, SegmentedScan, CrossTypes);
+
+template <typename Tuple>
+struct SegmentedReduce : public ::testing::Test {
+};
+
+TYPED_TEST_SUITE_P(SegmentedReduce);
+
+TYPED_TEST_P(SegmentedReduce, reduce_segmented)
+{
+  using T = typename Info<TypeParam>::data_type;
+  using Function = typename Info<TypeParam>::function;
+
+  // segments of growing length, several spanning many chunks of work, with
+  // empty segments in between and at both ends
+  std::vector<int> offsets{0, 0};
+  for (int len = 1; offsets.back() + len <= N; len = len * 3 + 1) {
+    offsets.push_back(offsets.back() + len);
+    offsets.push_back(offsets.back());
+  }
+  offsets.push_back(N);
+  offsets.push_back(N);
+  const int nsegs = offsets.size() - 1;
+
+  std::vector<T> values(N);
+  for (int i = 0; i < N; ++i) {
+    values[i] = static_cast<T>((i * 7919) % 1000);
+  }
+
+  std::vector<T> out(nsegs);
+  RAJA::reduce_segmented(typename Info<TypeParam>::exec(),
+                         values.data(),
+                         offsets.data(),
+                         nsegs,
+                         out.data(),
+                         Function{});
+
+  for (int s = 0; s < nsegs; ++s) {
+    T expected = Function::identity();
+    for (int i = offsets[s]; i < offsets[s + 1]; ++i) {
+      expected = Function()(expected, values[i]);
+    }
+    ASSERT_EQ(expected, out[s]) << "segment " << s;
+  }
+}
+
+TYPED_TEST_P(SegmentedReduce, reduce_by_key)
+{
+  using T = typename Info<TypeParam>::data_type;
+  using Function = typename Info<TypeParam>::function;
+
+  std::vector<int> keys(N);
+  std::vector<T> values(N);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = (i < N / 2) ? i / 3 : i / 5000;
+    values[i] = static_cast<T>((i * 7919) % 1000);
+  }
+
+  std::vector<int> out_keys(N);
+  std::vector<T> out_values(N);
+  RAJA::Index_type nkeys =
+      RAJA::reduce_by_key(typename Info<TypeParam>::exec(),
+                          keys,
+                          values.begin(),
+                          out_keys.begin(),
+                          out_values.begin(),
+                          Function{});
+
+  int run = -1;
+  std::vector<int> expected_keys;
+  std::vector<T> expected_values;
+  for (int i = 0; i < N; ++i) {
+    if (i == 0 || keys[i] != keys[i - 1]) {
+      expected_keys.push_back(keys[i]);
+      expected_values.push_back(Function::identity());
+      ++run;
+    }
+    expected_values[run] = Function()(expected_values[run], values[i]);
+  }
+
+  ASSERT_EQ(static_cast<RAJA::Index_type>(expected_keys.size()), nkeys);
+  for (int k = 0; k < nkeys; ++k) {
+    ASSERT_EQ(expected_keys[k], out_keys[k]);
+    ASSERT_EQ(expected_values[k], out_values[k]) << "key " << keys[k];
+  }
+
+  ASSERT_EQ(0,
+            RAJA::reduce_by_key(typename Info<TypeParam>::exec(),
+                                keys.data(),
+                                keys.data(),
+                                values.data(),
+                                out_keys.data(),
+                                out_values.data(),
+                                Function{}));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SegmentedReduce, reduce_segmented, reduce_by_key);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(SegmentedReduceTests,
+                               SegmentedReduce,
+                               CrossTypes);
+
+template <typename Tuple>
+struct Transform : public ::testing::Test {
+};
+
+TYPED_TEST_SUITE_P(Transform);
+
+//! the value of index i, computed on the fly instead of read from an array
+template <typename T>
+struct IndexValue {
+  T operator()(RAJA::Index_type i) const
+  {
+    return static_cast<T>((i * 7919) % 1000);
+  }
+};
+
+TYPED_TEST_P(Transform, transform_inclusive_scan)
+{
+  using T = typename Info<TypeParam>::data_type;
+  using Function = typename Info<TypeParam>::function;
+
+  RAJA::RangeSegment range(0, N);
+  std::vector<T> values(N);
+  std::transform(range.begin(), range.end(), values.begin(), IndexValue<T>{});
+
+  std::vector<T> out(N);
+  RAJA::transform_inclusive_scan(typename Info<TypeParam>::exec(),
+                                 range.begin(),
+                                 range.end(),
+                                 out.begin(),
+                                 IndexValue<T>{},
+                                 Function{});
+
+  ASSERT_TRUE(check_inclusive<Function>(out.data(), values.data()));
+}
+
+TYPED_TEST_P(Transform, transform_exclusive_scan)
+{
+  using T = typename Info<TypeParam>::data_type;
+  using Function = typename Info<TypeParam>::function;
+
+  std::vector<int> index(N);
+  std::iota(index.begin(), index.end(), 0);
+  std::vector<T> values(N);
+  std::transform(index.begin(), index.end(), values.begin(), IndexValue<T>{});
+
+  std::vector<T> out(N);
+  RAJA::transform_exclusive_scan(typename Info<TypeParam>::exec(),
+                                 index.data(),
+                                 index.data() + N,
+                                 out.data(),
+                                 IndexValue<T>{},
+                                 Function{},
+                                 T(2));
+
+  ASSERT_TRUE(check_exclusive<Function>(out.data(), values.data(), T(2)));
+}
+
+TYPED_TEST_P(Transform, transform_reduce)
+{
+  using T = typename Info<TypeParam>::data_type;
+  using Function = typename Info<TypeParam>::function;
+
+  RAJA::RangeSegment range(0, N);
+  T expected = T(5);
+  for (int i = 0; i < N; ++i) {
+    expected = Function()(expected, IndexValue<T>{}(i));
+  }
+
+  ASSERT_EQ(expected,
+            RAJA::transform_reduce(typename Info<TypeParam>::exec(),
+                                   range.begin(),
+                                   range.end(),
+                                   IndexValue<T>{},
+                                   Function{},
+                                   T(5)));
+  ASSERT_EQ(T(5),
+            RAJA::transform_reduce(typename Info<TypeParam>::exec(),
+                                   range.begin(),
+                                   range.begin(),
+                                   IndexValue<T>{},
+                                   Function{},
+                                   T(5)));
+}
+
+//! counts its calls, which the transform scans make at most once per element
+struct CountedValue {
+  std::atomic<int>* calls;
+  int operator()(RAJA::Index_type i) const
+  {
+    ++*calls;
+    return static_cast<int>(i % 3);
+  }
+};
+
+TYPED_TEST_P(Transform, transform_scan_calls_unop_once)
+{
+  using Exec = typename Info<TypeParam>::exec;
+
+  RAJA::RangeSegment range(0, N);
+  std::vector<int> out(N);
+  std::atomic<int> calls(0);
+  RAJA::transform_inclusive_scan(
+      Exec(), range.begin(), range.end(), out.begin(), CountedValue{&calls});
+  ASSERT_EQ(N, calls.load());
+  int sum = 0;
+  for (int i = 0; i < N; ++i) {
+    sum += i % 3;
+    ASSERT_EQ(sum, out[i]);
+  }
+
+  calls = 0;
+  RAJA::transform_exclusive_scan(
+      Exec(), range.begin(), range.end(), out.begin(), CountedValue{&calls});
+  ASSERT_LE(calls.load(), N);
+  ASSERT_EQ(sum - (N - 1) % 3, out[N - 1]);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(Transform,
+                           transform_inclusive_scan,
+                           transform_exclusive_scan,
+                           transform_scan_calls_unop_once,
+                           transform_reduce);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(TransformTests, Transform, CrossTypes);
@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA CPU scatter-add operations.
+///
+
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+template <typename ExecPolicy>
+class Scatter : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(Scatter);
+
+//! bins whose runs of equal bins vary in length and position
+static RAJA::Index_type scatter_bin(RAJA::Index_type i, RAJA::Index_type m)
+{
+  return ((i / (1 + i % 5)) * 7919) % m;
+}
+
+template <typename ExecPolicy, typename T>
+void testScatterAdd()
+{
+  for (RAJA::Index_type m : {1, 3, 16, 4096}) {
+    for (RAJA::Index_type n : {0, 5, 8, 1003, 100000}) {
+      std::vector<T> expected(m, T(0));
+      for (RAJA::Index_type i = 0; i < n; ++i) {
+        expected[scatter_bin(i, m)] += T(i % 13);
+      }
+
+      std::vector<T> bins(m, T(0));
+      RAJA::scatter_add<ExecPolicy>(
+          RAJA::RangeSegment(0, n),
+          bins.data(),
+          [=](RAJA::Index_type i, RAJA::Index_type &bin, T &value) {
+            bin = scatter_bin(i, m);
+            value = T(i % 13);
+          });
+
+      for (RAJA::Index_type b = 0; b < m; ++b) {
+        ASSERT_EQ(expected[b], bins[b]) << "m " << m << " n " << n;
+      }
+    }
+  }
+}
+
+TYPED_TEST_P(Scatter, AddDouble) { testScatterAdd<TypeParam, double>(); }
+
+TYPED_TEST_P(Scatter, AddInteger)
+{
+  testScatterAdd<TypeParam, long long>();
+  testScatterAdd<TypeParam, int>();
+}
+
+TYPED_TEST_P(Scatter, RepeatedLanes)
+{
+  // every arrangement of eight lanes over two bins
+  std::vector<double> bins(2, 0.0);
+  RAJA::scatter_add<TypeParam>(
+      RAJA::RangeSegment(0, 256 * 8),
+      bins.data(),
+      [=](RAJA::Index_type i, RAJA::Index_type &bin, double &value) {
+        bin = ((i / 8) >> (i % 8)) & 1;
+        value = 1.0;
+      });
+
+  ASSERT_EQ(1024.0, bins[0]);
+  ASSERT_EQ(1024.0, bins[1]);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(Scatter, AddDouble, AddInteger, RepeatedLanes);
+
+using ScatterTypes = ::testing::Types<RAJA::seq_exec,
+                                      RAJA::loop_exec,
+                                      RAJA::simd_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                      ,
+                                      RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                      ,
+                                      RAJA::tbb_for_exec
+#endif
+                                      >;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(ScatterTests, Scatter, ScatterTypes);
@@ -0,0 +1,145 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA CPU batched sorted searches.
+///
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+const int N = 10007;
+
+template <typename ExecPolicy>
+class Search : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(Search);
+
+//! table with repeated entries, as in a tabulated equation of state
+static std::vector<double> make_table(int n)
+{
+  std::vector<double> table(n);
+  for (int i = 0; i < n; ++i) {
+    table[i] = 0.5 * (i / 3);
+  }
+  return table;
+}
+
+//! queries below, inside, on and above the entries of the table
+static std::vector<double> make_queries(int n, double top)
+{
+  std::vector<double> queries(n);
+  for (int i = 0; i < n; ++i) {
+    queries[i] = ((i * 7919) % 10007) * (top + 2.0) / 10007 - 1.0;
+    if (i % 5 == 0) queries[i] = 0.5 * ((i * 31) % 1000);
+  }
+  return queries;
+}
+
+TYPED_TEST_P(Search, Bounds)
+{
+  for (int len : {0, 1, 2, 17, 1000, N}) {
+    const std::vector<double> table = make_table(len);
+    const std::vector<double> queries =
+        make_queries(N, len > 0 ? table.back() : 1.0);
+    std::vector<RAJA::Index_type> lower(N, -1);
+    std::vector<long> upper(N, -1);
+
+    RAJA::lower_bound_batch(
+        TypeParam(), table.data(), len, queries.data(), N, lower.data());
+    RAJA::upper_bound_batch<TypeParam>(
+        table.begin(), len, queries.begin(), N, upper.begin());
+
+    for (int q = 0; q < N; ++q) {
+      ASSERT_EQ(std::lower_bound(table.begin(), table.end(), queries[q])
+                    - table.begin(),
+                lower[q]);
+      ASSERT_EQ(std::upper_bound(table.begin(), table.end(), queries[q])
+                    - table.begin(),
+                upper[q]);
+    }
+  }
+}
+
+TYPED_TEST_P(Search, SortedBounds)
+{
+  for (int len : {0, 1, 17, N}) {
+    const std::vector<double> table = make_table(len);
+    for (int nq : {1, 100, 3 * N}) {
+      std::vector<double> queries =
+          make_queries(nq, len > 0 ? table.back() : 1.0);
+      std::sort(queries.begin(), queries.end());
+      std::vector<int> lower(nq, -1);
+      std::vector<int> upper(nq, -1);
+
+      RAJA::lower_bound_batch_sorted(
+          TypeParam(), table.data(), len, queries.data(), nq, lower.data());
+      RAJA::upper_bound_batch_sorted(
+          TypeParam(), table.data(), len, queries.data(), nq, upper.data());
+
+      for (int q = 0; q < nq; ++q) {
+        ASSERT_EQ(std::lower_bound(table.begin(), table.end(), queries[q])
+                      - table.begin(),
+                  lower[q]);
+        ASSERT_EQ(std::upper_bound(table.begin(), table.end(), queries[q])
+                      - table.begin(),
+                  upper[q]);
+      }
+    }
+  }
+}
+
+TYPED_TEST_P(Search, Comparator)
+{
+  std::vector<int> table(N);
+  for (int i = 0; i < N; ++i) {
+    table[i] = N - i;
+  }
+  std::vector<int> queries(N);
+  for (int i = 0; i < N; ++i) {
+    queries[i] = (i * 7919) % (N + 3);
+  }
+  std::vector<int> out(N);
+
+  RAJA::lower_bound_batch(TypeParam(),
+                          table.data(),
+                          N,
+                          queries.data(),
+                          N,
+                          out.data(),
+                          std::greater<int>());
+
+  for (int q = 0; q < N; ++q) {
+    ASSERT_EQ(std::lower_bound(
+                  table.begin(), table.end(), queries[q], std::greater<int>())
+                  - table.begin(),
+              out[q]);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(Search, Bounds, SortedBounds, Comparator);
+
+using SearchTypes = ::testing::Types<RAJA::seq_exec,
+                                     RAJA::simd_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                     ,
+                                     RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                     ,
+                                     RAJA::tbb_for_exec
+#endif
+                                     >;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(SearchTests, Search, SearchTypes);
@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA CPU selection operations.
+///
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+const int N = 200003;
+
+template <typename ExecPolicy>
+class Select : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(Select);
+
+static std::vector<double> make_data(int n)
+{
+  std::vector<double> data(n);
+  for (int i = 0; i < n; ++i) {
+    data[i] = ((i * 7919) % 100003) * 0.01 + (i % 7 == 0 ? 1000.0 : 0.0);
+  }
+  return data;
+}
+
+TYPED_TEST_P(Select, NthElement)
+{
+  for (int n : {1, 1000, N}) {
+    for (int k : {0, n / 20, n / 2, n - n / 20 - 1, n - 1}) {
+      std::vector<double> data = make_data(n);
+      std::vector<double> sorted = data;
+      std::sort(sorted.begin(), sorted.end());
+
+      RAJA::nth_element(
+          TypeParam(), data.begin(), data.begin() + k, data.end());
+
+      ASSERT_EQ(sorted[k], data[k]);
+      for (int i = 0; i < k; ++i) {
+        ASSERT_LE(data[i], data[k]);
+      }
+      for (int i = k + 1; i < n; ++i) {
+        ASSERT_GE(data[i], data[k]);
+      }
+    }
+  }
+}
+
+TYPED_TEST_P(Select, NthElementDuplicates)
+{
+  std::vector<int> data(N);
+  for (int i = 0; i < N; ++i) {
+    data[i] = (i * 31) % 5;
+  }
+  std::vector<int> sorted = data;
+  std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+
+  const int k = N / 3;
+  RAJA::nth_element<TypeParam>(
+      data.data(), data.data() + k, data.data() + N, std::greater<int>());
+  ASSERT_EQ(sorted[k], data[k]);
+}
+
+TYPED_TEST_P(Select, Percentile)
+{
+  for (int n : {1, 2, 1000, N}) {
+    const std::vector<double> data = make_data(n);
+    std::vector<double> sorted = data;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (double q : {0.0, 0.05, 0.5, 0.95, 1.0}) {
+      const int k = static_cast<int>(std::floor(q * (n - 1)));
+      ASSERT_EQ(sorted[k], RAJA::percentile(TypeParam(), data, q));
+      ASSERT_EQ(sorted[k],
+                RAJA::percentile<TypeParam>(data.begin(), data.end(), q));
+    }
+    ASSERT_EQ(make_data(n), data);
+  }
+  std::vector<double> empty;
+  ASSERT_EQ(0.0, RAJA::percentile(TypeParam(), empty, 0.5));
+}
+
+TYPED_TEST_P(Select, PercentileApprox)
+{
+  const std::vector<double> data = make_data(N);
+  std::vector<double> sorted = data;
+  std::sort(sorted.begin(), sorted.end());
+
+  for (double tol : {0.5, 1e-3}) {
+    for (double q : {0.0, 0.5, 0.95, 1.0}) {
+      const double exact = sorted[static_cast<int>(std::floor(q * (N - 1)))];
+      const double approx = RAJA::percentile_approx(
+          TypeParam(), data.begin(), data.end(), q, 0.0, 2001.0, tol);
+      ASSERT_NEAR(exact, approx, tol);
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(Select,
+                           NthElement,
+                           NthElementDuplicates,
+                           Percentile,
+                           PercentileApprox);
+
+using SelectTypes = ::testing::Types<RAJA::seq_exec,
+                                     RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                     ,
+                                     RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                     ,
+                                     RAJA::tbb_for_exec
+#endif
+                                     >;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(SelectTests, Select, SelectTypes);
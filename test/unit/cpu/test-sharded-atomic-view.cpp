@@ -0,0 +1,135 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA::ShardedAtomicView.
+///
+
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+template <typename ExecPolicy>
+class ShardedAtomicView : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(ShardedAtomicView);
+
+// scatter-add of n updates into m elements, in runs of consecutive updates
+// to the same element, checked against a serial sum
+template <typename ExecPolicy>
+static void check_scatter_add(RAJA::Index_type m,
+                              RAJA::Index_type n,
+                              RAJA::Index_type run = 1)
+{
+  std::vector<long> target(m, 1);
+  std::vector<long> expected(m, 1);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    expected[(i / run * 7919) % m] += i % 13;
+  }
+
+  RAJA::View<long, RAJA::Layout<1>> view(target.data(), m);
+  {
+    auto sharded = RAJA::make_sharded_atomic_view(view);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+      sharded((i / run * 7919) % m) += i % 13;
+    });
+    sharded.flush();
+    ASSERT_EQ(expected, target);
+
+    // the buffers are reused after a flush; the last updates are added
+    // when the view is destroyed
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+      sharded((i / run * 7919) % m) -= i % 13;
+    });
+  }
+  for (RAJA::Index_type j = 0; j < m; ++j) {
+    ASSERT_EQ(1, target[j]);
+  }
+}
+
+TYPED_TEST_P(ShardedAtomicView, DenseScatterAdd)
+{
+  check_scatter_add<TypeParam>(1, 100000);
+  check_scatter_add<TypeParam>(1000, 100000);
+  check_scatter_add<TypeParam>(RAJA::detail::sharded_dense_max, 100000);
+}
+
+TYPED_TEST_P(ShardedAtomicView, HashedScatterAdd)
+{
+  check_scatter_add<TypeParam>(RAJA::detail::sharded_dense_max + 1, 200000);
+  check_scatter_add<TypeParam>(1000003, 200000);
+  // updates that repeat stay buffered rather than going straight to the
+  // target
+  check_scatter_add<TypeParam>(1000003, 200000, 16);
+}
+
+TYPED_TEST_P(ShardedAtomicView, MultiDimensional)
+{
+  const int ni = 50, nj = 40;
+  std::vector<double> target(ni * nj, 0.0);
+  RAJA::View<double, RAJA::Layout<2>> view(target.data(), ni, nj);
+  auto sharded = RAJA::make_sharded_atomic_view<RAJA::auto_atomic>(view);
+
+  // every element is updated from four different iterations
+  RAJA::forall<TypeParam>(RAJA::RangeSegment(0, 4 * ni * nj),
+                          [=](RAJA::Index_type k) {
+                            const int e = k % (ni * nj);
+                            sharded(e / nj, e % nj) += 0.5;
+                          });
+  sharded.flush(TypeParam());
+
+  for (int i = 0; i < ni; ++i) {
+    for (int j = 0; j < nj; ++j) {
+      ASSERT_EQ(2.0, view(i, j));
+    }
+  }
+}
+
+TYPED_TEST_P(ShardedAtomicView, TwoViews)
+{
+  // two views updated in the same loop keep separate buffers
+  const int m = 100;
+  std::vector<int> a(m, 0), b(m, 0);
+  RAJA::View<int, RAJA::Layout<1>> va(a.data(), m), vb(b.data(), m);
+  auto sa = RAJA::make_sharded_atomic_view(va);
+  auto sb = RAJA::make_sharded_atomic_view(vb);
+  RAJA::forall<TypeParam>(RAJA::RangeSegment(0, 10 * m),
+                          [=](RAJA::Index_type i) {
+                            sa(i % m) += 1;
+                            sb((i * 7) % m) += 2;
+                          });
+  sa.flush();
+  sb.flush();
+  for (int j = 0; j < m; ++j) {
+    ASSERT_EQ(10, a[j]);
+    ASSERT_EQ(20, b[j]);
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ShardedAtomicView,
+                            DenseScatterAdd,
+                            HashedScatterAdd,
+                            MultiDimensional,
+                            TwoViews);
+
+using ShardedTypes = ::testing::Types<RAJA::seq_exec,
+                                      RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                      ,
+                                      RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                      ,
+                                      RAJA::tbb_for_exec
+#endif
+                                      >;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(ShardedTests, ShardedAtomicView, ShardedTypes);
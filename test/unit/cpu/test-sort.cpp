@@ -0,0 +1,220 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA CPU sort operations.
+///
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+const int N = 100003;
+
+template <typename ExecPolicy>
+class Sort : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(Sort);
+
+struct Particle {
+  int cell;
+  int id;
+};
+
+struct CellLess {
+  bool operator()(Particle const& a, Particle const& b) const
+  {
+    return a.cell < b.cell;
+  }
+};
+
+static std::vector<int> make_data(int n)
+{
+  std::vector<int> data(n);
+  for (int i = 0; i < n; ++i) {
+    data[i] = (i * 7919) % 10007 - 5000;
+  }
+  return data;
+}
+
+TYPED_TEST_P(Sort, SortInts)
+{
+  for (int n : {0, 1, 2, 1000, N}) {
+    std::vector<int> data = make_data(n);
+    std::vector<int> expected = data;
+    std::sort(expected.begin(), expected.end());
+
+    RAJA::sort(TypeParam(), data.begin(), data.end());
+    ASSERT_EQ(expected, data);
+  }
+}
+
+TYPED_TEST_P(Sort, SortComparator)
+{
+  std::vector<int> data = make_data(N);
+  std::vector<int> expected = data;
+  std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+  RAJA::sort(TypeParam(), data, std::greater<int>());
+  ASSERT_EQ(expected, data);
+
+  RAJA::stable_sort(TypeParam(), data.data(), data.data() + N);
+  ASSERT_TRUE(std::is_sorted(data.begin(), data.end()));
+}
+
+TYPED_TEST_P(Sort, StableSort)
+{
+  for (int n : {0, 1, 1000, N}) {
+    std::vector<Particle> particles(n);
+    for (int i = 0; i < n; ++i) {
+      particles[i] = Particle{(i * 31) % 97, i};
+    }
+
+    RAJA::stable_sort(
+        TypeParam(), particles.begin(), particles.end(), CellLess{});
+
+    for (int i = 1; i < n; ++i) {
+      ASSERT_TRUE(particles[i - 1].cell < particles[i].cell
+                  || (particles[i - 1].cell == particles[i].cell
+                      && particles[i - 1].id < particles[i].id));
+    }
+  }
+}
+
+//! sort keys and values with std::stable_sort and compare with sort_pairs
+template <typename ExecPolicy, typename Key, typename... Bits>
+static void check_sort_pairs(std::vector<Key> keys, Bits... bits)
+{
+  const int n = static_cast<int>(keys.size());
+  std::vector<std::pair<Key, int>> expected(n);
+  std::vector<int> values(n);
+  for (int i = 0; i < n; ++i) {
+    expected[i] = std::make_pair(keys[i], i);
+    values[i] = i;
+  }
+  using Pair = std::pair<Key, int>;
+  std::stable_sort(
+      expected.begin(), expected.end(), [](Pair const& a, Pair const& b) {
+        return a.first < b.first;
+      });
+
+  RAJA::sort_pairs(ExecPolicy(), keys.data(), values.begin(), n, bits...);
+
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(expected[i].first, keys[i]);
+    ASSERT_EQ(expected[i].second, values[i]);
+  }
+}
+
+TYPED_TEST_P(Sort, SortPairs)
+{
+  for (int n : {0, 1, 1000, 3 * N}) {
+    std::vector<std::uint64_t> cells(n);
+    std::vector<int> ints(n);
+    std::vector<double> reals(n);
+    for (int i = 0; i < n; ++i) {
+      cells[i] = (std::uint64_t(i % 997) << 40) | (i * 7919 % 10007);
+      ints[i] = (i * 7919) % 10007 - 5000;
+      reals[i] = ints[i] * 0.25;
+    }
+    if (n > 2) {
+      reals[0] = -0.0;
+      reals[1] = 0.0;
+    }
+
+    check_sort_pairs<TypeParam>(cells);
+    check_sort_pairs<TypeParam>(ints);
+    check_sort_pairs<TypeParam>(reals);
+  }
+}
+
+TYPED_TEST_P(Sort, SortPairsBitRange)
+{
+  std::vector<std::uint32_t> keys(N);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = ((i * 7919) % 4096) << 4;
+  }
+  check_sort_pairs<TypeParam>(keys, 4, 16);
+
+  RAJA::RadixSortScratch<std::uint32_t, int> scratch;
+  std::vector<int> values(N);
+  for (int pass = 0; pass < 2; ++pass) {
+    std::vector<std::uint32_t> k = keys;
+    RAJA::sort_pairs<TypeParam>(k.begin(), values.data(), N, scratch);
+    ASSERT_TRUE(std::is_sorted(k.begin(), k.end()));
+  }
+  ASSERT_EQ(static_cast<size_t>(N), scratch.keys.size());
+}
+
+TYPED_TEST_P(Sort, Merge)
+{
+  for (int na : {0, 1, 1000, N}) {
+    for (int nb : {0, 7, 2 * N}) {
+      std::vector<Particle> a(na);
+      std::vector<Particle> b(nb);
+      for (int i = 0; i < na; ++i) {
+        a[i] = Particle{i / 3, i};
+      }
+      for (int i = 0; i < nb; ++i) {
+        b[i] = Particle{i / 5, na + i};
+      }
+      std::vector<Particle> expected(na + nb);
+      std::merge(a.begin(),
+                 a.end(),
+                 b.begin(),
+                 b.end(),
+                 expected.begin(),
+                 CellLess{});
+
+      std::vector<Particle> out(na + nb);
+      ASSERT_EQ(na + nb,
+                RAJA::merge(TypeParam(), a, b, out.begin(), CellLess{}));
+      for (int i = 0; i < na + nb; ++i) {
+        ASSERT_EQ(expected[i].id, out[i].id);
+      }
+    }
+  }
+
+  std::vector<int> a = make_data(N);
+  std::vector<int> b = make_data(1000);
+  std::sort(a.begin(), a.end());
+  std::sort(b.begin(), b.end());
+  std::vector<int> out(N + 1000);
+  RAJA::merge<TypeParam>(
+      a.data(), a.data() + N, b.begin(), b.end(), out.data());
+  ASSERT_TRUE(std::is_sorted(out.begin(), out.end()));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(Sort,
+                           SortInts,
+                           SortComparator,
+                           StableSort,
+                           SortPairs,
+                           SortPairsBitRange,
+                           Merge);
+
+using SortTypes = ::testing::Types<RAJA::seq_exec,
+                                   RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                   ,
+                                   RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                   ,
+                                   RAJA::tbb_for_exec
+#endif
+                                   >;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(SortTests, Sort, SortTypes);
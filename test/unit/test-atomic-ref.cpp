@@ -17,6 +17,9 @@ TEST(Atomic, basic_OpenMP_AtomicRef)
 {
   testAtomicRefPol<RAJA::omp_for_exec, RAJA::omp_atomic>();
   testAtomicRefPol<RAJA::omp_for_exec, RAJA::builtin_atomic>();
+  testAtomicRefPol<RAJA::omp_for_exec, RAJA::omp_atomic_relaxed>();
+  testAtomicRefPol<RAJA::omp_for_exec, RAJA::builtin_atomic_relaxed>();
+  testAtomicRefPol<RAJA::omp_for_exec, RAJA::builtin_atomic_backoff>();
 }
 
 #endif
@@ -44,6 +47,8 @@ TEST(Atomic, basic_seq_AtomicRef)
 {
   testAtomicRefPol<RAJA::seq_exec, RAJA::seq_atomic>();
   testAtomicRefPol<RAJA::seq_exec, RAJA::builtin_atomic>();
+  testAtomicRefPol<RAJA::seq_exec, RAJA::builtin_atomic_relaxed>();
+  testAtomicRefPol<RAJA::seq_exec, RAJA::builtin_atomic_backoff>();
 }
 #endif
 
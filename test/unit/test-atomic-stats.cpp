@@ -0,0 +1,131 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the per call site atomic statistics of
+/// builds with RAJA_ENABLE_ATOMIC_STATS
+///
+
+#include <RAJA/RAJA.hpp>
+#include "RAJA_gtest.hpp"
+
+#include <cstring>
+
+// the counts of the site at line of this file
+static RAJA::util::AtomicSiteStats site_stats(unsigned line)
+{
+  for (RAJA::util::AtomicSiteStats const &site :
+       RAJA::util::getAtomicStats()) {
+    if (site.line == line
+        && site.file.find("test-atomic-stats.cpp") != std::string::npos) {
+      return site;
+    }
+  }
+  return RAJA::util::AtomicSiteStats{"", line, 0, 0};
+}
+
+TEST(AtomicStats, CountsOperationsPerSite)
+{
+  RAJA::util::resetAtomicStats();
+  const int N = 1000;
+  int *count = new int(0);
+  double *sum = new double(0.0);
+
+  const unsigned add_line = __LINE__ + 3;
+  const unsigned sub_line = __LINE__ + 3;
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N), [=](int i) {
+    RAJA::atomicAdd<RAJA::builtin_atomic>(count, 1);
+    RAJA::atomicSub<RAJA::builtin_atomic>(sum, double(i));
+  });
+
+  ASSERT_EQ(N, *count);
+  ASSERT_EQ(N, static_cast<int>(site_stats(add_line).operations));
+  ASSERT_EQ(N, static_cast<int>(site_stats(sub_line).operations));
+  // without other threads no compare-and-swap fails
+  ASSERT_EQ(0u, site_stats(sub_line).retries);
+
+  RAJA::util::resetAtomicStats();
+  ASSERT_EQ(0u, site_stats(add_line).operations);
+
+  delete count;
+  delete sum;
+}
+
+TEST(AtomicStats, CountsViewsAtTheirCallSites)
+{
+  RAJA::util::resetAtomicStats();
+  const int N = 1000;
+  double *bins = new double[4]();
+  auto view = RAJA::make_atomic_view<RAJA::builtin_atomic>(
+      RAJA::View<double, RAJA::Layout<2>>(bins, 2, 2));
+  double *sum = new double(0.0);
+
+  // an AtomicRef counts its operations where it was created
+  const unsigned ref_line = __LINE__ + 1;
+  RAJA::AtomicRef<double, RAJA::builtin_atomic> ref(sum);
+  const unsigned view_line = __LINE__ + 2;
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N), [=](int i) {
+    view(i % 2, i / 2 % 2) += 1.0;
+    ref += 1.0;
+  });
+
+  ASSERT_EQ(double(N / 4), bins[3]);
+  ASSERT_EQ(double(N), *sum);
+  ASSERT_EQ(N, static_cast<int>(site_stats(view_line).operations));
+  ASSERT_EQ(N, static_cast<int>(site_stats(ref_line).operations));
+
+  delete sum;
+  delete[] bins;
+}
+
+TEST(AtomicStats, CountsShardedViewFlushedOnDestruction)
+{
+  RAJA::util::resetAtomicStats();
+  // large enough for hashed buffers, which are drained with atomics
+  const int M = 1 << 20;
+  double *bins = new double[M]();
+
+  const unsigned make_line = __LINE__ + 2;
+  {
+    auto view = RAJA::make_sharded_atomic_view<RAJA::builtin_atomic>(
+        RAJA::View<double, RAJA::Layout<1>>(bins, M));
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 100), [=](int i) {
+      view(i % 10) += 1.0;
+    });
+  }
+
+  ASSERT_EQ(10.0, bins[3]);
+  ASSERT_EQ(10, static_cast<int>(site_stats(make_line).operations));
+  for (RAJA::util::AtomicSiteStats const &site :
+       RAJA::util::getAtomicStats()) {
+    ASSERT_EQ(std::string::npos, site.file.find("include/RAJA"))
+        << site.file << ":" << site.line;
+  }
+
+  delete[] bins;
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(AtomicStats, MergesThreads)
+{
+  RAJA::util::resetAtomicStats();
+  const int N = 100000;
+  double *sum = new double(0.0);
+
+  const unsigned line = __LINE__ + 2;
+  RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N), [=](int) {
+    RAJA::atomicAdd<RAJA::builtin_atomic>(sum, 1.0);
+  });
+
+  ASSERT_EQ(double(N), *sum);
+  RAJA::util::AtomicSiteStats site = site_stats(line);
+  ASSERT_EQ(N, static_cast<int>(site.operations));
+  ASSERT_LE(site.retries, site.operations * 1000);
+
+  delete sum;
+}
+#endif
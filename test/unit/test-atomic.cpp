@@ -465,6 +465,59 @@ void testAtomicLogicalPol_gpu()
 
 #endif //RAJA_ENABLE_HIP
 
+template <typename ExecPolicy, typename AtomicPolicy, typename T, typename I>
+void testAtomicMinMaxLoc()
+{
+  using MinLoc = RAJA::reduce::detail::ValueLoc<T, I, true>;
+  using MaxLoc = RAJA::reduce::detail::ValueLoc<T, I, false>;
+  const I N = 10000;
+  T *x = new T[N];
+  for (I i = 0; i < N; ++i) {
+    x[i] = static_cast<T>((i * 7919) % 1000);
+  }
+
+  // a 16-byte aligned pair and, for 16-byte pairs, one that is not
+  struct alignas(16) Targets {
+    MinLoc min;
+    MaxLoc max;
+    char pad[8];
+    MinLoc min_unaligned;
+  };
+  Targets *t = new Targets;
+  t->min = MinLoc(T(2000), I(-1));
+  t->max = MaxLoc(T(-1), I(-1));
+  t->min_unaligned = MinLoc(T(2000), I(-1));
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+    RAJA::atomicMinLoc<AtomicPolicy>(&t->min, x[i], I(i));
+    RAJA::atomicMaxLoc<AtomicPolicy>(&t->max, x[i], I(i));
+    RAJA::atomicMinLoc<AtomicPolicy>(&t->min_unaligned, x[i], I(i));
+  });
+
+  // values repeat every 1000 entries, so ties go to the first location
+  I min_loc = 0, max_loc = 0;
+  for (I i = 0; i < N; ++i) {
+    if (x[i] < x[min_loc]) min_loc = i;
+    if (x[i] > x[max_loc]) max_loc = i;
+  }
+  ASSERT_EQ(x[min_loc], t->min.val);
+  ASSERT_EQ(min_loc, t->min.loc);
+  ASSERT_EQ(x[max_loc], t->max.val);
+  ASSERT_EQ(max_loc, t->max.loc);
+  ASSERT_EQ(x[min_loc], t->min_unaligned.val);
+  ASSERT_EQ(min_loc, t->min_unaligned.loc);
+
+  delete t;
+  delete[] x;
+}
+
+template <typename ExecPolicy, typename AtomicPolicy>
+void testAtomicMinMaxLocPol()
+{
+  testAtomicMinMaxLoc<ExecPolicy, AtomicPolicy, double, RAJA::Index_type>();
+  testAtomicMinMaxLoc<ExecPolicy, AtomicPolicy, float, int>();
+}
+
 #if defined(RAJA_ENABLE_OPENMP)
 
 TEST(Atomic, basic_OpenMP_AtomicFunction)
@@ -472,6 +525,9 @@ TEST(Atomic, basic_OpenMP_AtomicFunction)
   testAtomicFunctionPol<RAJA::omp_for_exec, RAJA::auto_atomic>();
   testAtomicFunctionPol<RAJA::omp_for_exec, RAJA::omp_atomic>();
   testAtomicFunctionPol<RAJA::omp_for_exec, RAJA::builtin_atomic>();
+  testAtomicFunctionPol<RAJA::omp_for_exec, RAJA::omp_atomic_relaxed>();
+  testAtomicFunctionPol<RAJA::omp_for_exec, RAJA::builtin_atomic_relaxed>();
+  testAtomicFunctionPol<RAJA::omp_for_exec, RAJA::builtin_atomic_backoff>();
 }
 
 
@@ -480,6 +536,9 @@ TEST(Atomic, basic_OpenMP_AtomicView)
   testAtomicViewPol<RAJA::omp_for_exec, RAJA::auto_atomic>();
   testAtomicViewPol<RAJA::omp_for_exec, RAJA::omp_atomic>();
   testAtomicViewPol<RAJA::omp_for_exec, RAJA::builtin_atomic>();
+  testAtomicViewPol<RAJA::omp_for_exec, RAJA::omp_atomic_relaxed>();
+  testAtomicViewPol<RAJA::omp_for_exec, RAJA::builtin_atomic_relaxed>();
+  testAtomicViewPol<RAJA::omp_for_exec, RAJA::builtin_atomic_backoff>();
 }
 
 
@@ -488,8 +547,69 @@ TEST(Atomic, basic_OpenMP_Logical)
   testAtomicLogicalPol<RAJA::omp_for_exec, RAJA::auto_atomic>();
   testAtomicLogicalPol<RAJA::omp_for_exec, RAJA::omp_atomic>();
   testAtomicLogicalPol<RAJA::omp_for_exec, RAJA::builtin_atomic>();
+  testAtomicLogicalPol<RAJA::omp_for_exec, RAJA::omp_atomic_relaxed>();
+  testAtomicLogicalPol<RAJA::omp_for_exec, RAJA::builtin_atomic_relaxed>();
+  testAtomicLogicalPol<RAJA::omp_for_exec, RAJA::builtin_atomic_backoff>();
+}
+
+
+template <typename T, RAJA::Index_type N>
+void testAtomicFetchOld()
+{
+  RAJA::RangeSegment seg(0, N);
+  T *counter = new T(0);
+  int *seen = new int[N]();
+
+  // every fetch-add returns a distinct old value of the counter
+  RAJA::forall<RAJA::omp_parallel_for_exec>(seg, [=](RAJA::Index_type) {
+    T old = RAJA::atomicAdd<RAJA::builtin_atomic>(counter, (T)1);
+    RAJA::atomicInc<RAJA::builtin_atomic>(seen + static_cast<int>(old));
+  });
+
+  EXPECT_EQ((T)N, *counter);
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    EXPECT_EQ(1, seen[i]);
+  }
+
+  delete counter;
+  delete[] seen;
+}
+
+TEST(Atomic, basic_OpenMP_BuiltinFetchOld)
+{
+  testAtomicFetchOld<int, 10000>();
+  testAtomicFetchOld<unsigned long long, 10000>();
+  testAtomicFetchOld<double, 10000>();
+}
+
+TEST(Atomic, basic_OpenMP_MinMaxLoc)
+{
+  testAtomicMinMaxLocPol<RAJA::omp_parallel_for_exec, RAJA::auto_atomic>();
+  testAtomicMinMaxLocPol<RAJA::omp_parallel_for_exec, RAJA::omp_atomic>();
+  testAtomicMinMaxLocPol<RAJA::omp_parallel_for_exec,
+                         RAJA::omp_atomic_relaxed>();
+  testAtomicMinMaxLocPol<RAJA::omp_parallel_for_exec, RAJA::builtin_atomic>();
+  testAtomicMinMaxLocPol<RAJA::omp_parallel_for_exec,
+                         RAJA::builtin_atomic_relaxed>();
+  testAtomicMinMaxLocPol<RAJA::omp_parallel_for_exec,
+                         RAJA::builtin_atomic_backoff>();
 }
 
+#if !defined(RAJA_COMPILER_MSVC)
+TEST(Atomic, basic_OpenMP_BuiltinNarrowInteger)
+{
+  testAtomicFetchOld<unsigned short, 10000>();
+  testAtomicLogical<RAJA::omp_parallel_for_exec,
+                    RAJA::builtin_atomic,
+                    unsigned char,
+                    10000>();
+  testAtomicLogical<RAJA::omp_parallel_for_exec,
+                    RAJA::builtin_atomic,
+                    short,
+                    10000>();
+}
+#endif
+
 #endif
 
 #if defined(RAJA_ENABLE_CUDA)
@@ -545,6 +665,8 @@ TEST(Atomic, basic_seq_AtomicFunction)
   testAtomicFunctionPol<RAJA::seq_exec, RAJA::auto_atomic>();
   testAtomicFunctionPol<RAJA::seq_exec, RAJA::seq_atomic>();
   testAtomicFunctionPol<RAJA::seq_exec, RAJA::builtin_atomic>();
+  testAtomicFunctionPol<RAJA::seq_exec, RAJA::builtin_atomic_relaxed>();
+  testAtomicFunctionPol<RAJA::seq_exec, RAJA::builtin_atomic_backoff>();
 }
 
 TEST(Atomic, basic_seq_AtomicView)
@@ -552,6 +674,8 @@ TEST(Atomic, basic_seq_AtomicView)
   testAtomicViewPol<RAJA::seq_exec, RAJA::auto_atomic>();
   testAtomicViewPol<RAJA::seq_exec, RAJA::seq_atomic>();
   testAtomicViewPol<RAJA::seq_exec, RAJA::builtin_atomic>();
+  testAtomicViewPol<RAJA::seq_exec, RAJA::builtin_atomic_relaxed>();
+  testAtomicViewPol<RAJA::seq_exec, RAJA::builtin_atomic_backoff>();
 }
 
 
@@ -560,4 +684,14 @@ TEST(Atomic, basic_seq_Logical)
   testAtomicLogicalPol<RAJA::seq_exec, RAJA::auto_atomic>();
   testAtomicLogicalPol<RAJA::seq_exec, RAJA::seq_atomic>();
   testAtomicLogicalPol<RAJA::seq_exec, RAJA::builtin_atomic>();
+  testAtomicLogicalPol<RAJA::seq_exec, RAJA::builtin_atomic_relaxed>();
+  testAtomicLogicalPol<RAJA::seq_exec, RAJA::builtin_atomic_backoff>();
+}
+
+TEST(Atomic, basic_seq_MinMaxLoc)
+{
+  testAtomicMinMaxLocPol<RAJA::seq_exec, RAJA::auto_atomic>();
+  testAtomicMinMaxLocPol<RAJA::seq_exec, RAJA::seq_atomic>();
+  testAtomicMinMaxLocPol<RAJA::seq_exec, RAJA::builtin_atomic>();
+  testAtomicMinMaxLocPol<RAJA::seq_exec, RAJA::builtin_atomic_backoff>();
 }
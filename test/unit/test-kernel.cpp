@@ -9,6 +9,7 @@
 #include "RAJA_gtest.hpp"
 
 #include <cstdio>
+#include <limits>
 
 #if defined(RAJA_ENABLE_CUDA)
 #include <cuda_runtime.h>
@@ -1790,6 +1791,174 @@ TEST(Kernel, ReduceSeqSum)
 }
 
 
+#if defined(RAJA_ENABLE_OPENMP)
+
+TEST(Kernel, ReduceOmpSum)
+{
+
+  int N = 1023;
+
+  int *data = new int[N];
+  for (int i = 0; i < N; ++i) {
+    data[i] = i;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::For<0, omp_parallel_for_exec,
+        Lambda<0>,
+        RAJA::statement::Reduce<omp_reduce, RAJA::operators::plus, Param<0>,
+          Lambda<1>
+        >
+      >
+     >;
+
+  int sum = 0;
+  int calls = 0;
+  int *sumPtr = &sum;
+  int *callsPtr = &calls;
+
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N)),
+
+      RAJA::make_tuple((int)5),
+
+      [=](Index_type i, int &value) {
+        value = data[i];
+      },
+      [=](Index_type, int &value) {
+        // runs once, after the loop, with the reduced value
+        (*sumPtr) += value;
+        (*callsPtr)++;
+      });
+
+  ASSERT_EQ(sum, 5 + N*(N-1)/2);
+  ASSERT_EQ(calls, 1);
+
+  delete[] data;
+}
+
+TEST(Kernel, ReduceOmpNestedMinMax)
+{
+
+  constexpr int N = 37;
+  constexpr int M = 53;
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::For<1, omp_parallel_exec<omp_for_nowait_exec>,
+        RAJA::statement::For<0, seq_exec,
+          Lambda<0>,
+          RAJA::statement::Reduce<omp_reduce, RAJA::operators::minimum, Param<0>,
+            Lambda<1>
+          >,
+          RAJA::statement::Reduce<omp_reduce, RAJA::operators::maximum, Param<1>,
+            Lambda<2>
+          >
+        >
+      >
+     >;
+
+  long min_val = 0;
+  long max_val = 0;
+  long *minPtr = &min_val;
+  long *maxPtr = &max_val;
+
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, M)),
+
+      RAJA::make_tuple(std::numeric_limits<long>::max(),
+                       std::numeric_limits<long>::lowest()),
+
+      [=](Index_type i, Index_type j, long &lo, long &hi) {
+        long v = (i - 11) * (j + 1);
+        lo = v;
+        hi = v;
+      },
+      [=](Index_type, Index_type, long &lo, long &) { *minPtr = lo; },
+      [=](Index_type, Index_type, long &, long &hi) { *maxPtr = hi; });
+
+  ASSERT_EQ(min_val, -11L * M);
+  ASSERT_EQ(max_val, (N - 12L) * M);
+}
+
+#endif  // RAJA_ENABLE_OPENMP
+
+
+#if defined(RAJA_ENABLE_TBB)
+
+TEST(Kernel, ReduceTBBSum)
+{
+
+  int N = 4099;
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::For<0, tbb_for_dynamic,
+        Lambda<0>,
+        RAJA::statement::Reduce<tbb_reduce, RAJA::operators::plus, Param<0>,
+          Lambda<1>
+        >
+      >
+     >;
+
+  long sum = 0;
+  int calls = 0;
+  long *sumPtr = &sum;
+  int *callsPtr = &calls;
+
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N)),
+
+      RAJA::make_tuple((long)0),
+
+      [=](Index_type i, long &value) {
+        value += i;
+      },
+      [=](Index_type, long &value) {
+        (*sumPtr) += value;
+        (*callsPtr)++;
+      });
+
+  ASSERT_EQ(sum, N*(N-1L)/2);
+  ASSERT_EQ(calls, 1);
+}
+
+TEST(Kernel, ReduceTBBStaticNested)
+{
+
+  constexpr int N = 64;
+  constexpr int M = 100;
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::For<1, tbb_for_static<8>,
+        RAJA::statement::For<0, seq_exec,
+          Lambda<0>
+        >,
+        RAJA::statement::Reduce<tbb_reduce, RAJA::operators::plus, Param<0>,
+          Lambda<1>
+        >
+      >
+     >;
+
+  long sum = 0;
+  long *sumPtr = &sum;
+
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, M)),
+
+      RAJA::make_tuple((long)0),
+
+      [=](Index_type i, Index_type j, long &value) {
+        value += i * M + j;
+      },
+      [=](Index_type, Index_type, long &value) {
+        (*sumPtr) += value;
+      });
+
+  ASSERT_EQ(sum, (N * M) * (N * M - 1L) / 2);
+}
+
+#endif  // RAJA_ENABLE_TBB
+
+
 
 #if defined(RAJA_ENABLE_CUDA)
 